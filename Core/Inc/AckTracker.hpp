@@ -0,0 +1,87 @@
+/**
+  ******************************************************************************
+  * @file			: AckTracker.hpp
+  * @brief			: Correlation of UBX Commands with their ACK / NAK Responses
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage:
+ * Every command which the receiver acknowledges (CFG class) is registered with submit() as it is transmitted, giving
+ * a deadline and an optional number of retries. Received UBX-ACK-ACK and UBX-ACK-NAK frames are passed to resolve(),
+ * and service() is called periodically with the current tick to expire requests. Each request ends exactly once, with
+ * its callback given the Result.
+ *
+ * The receiver acknowledges commands in the order they are received and identifies them only by class and ID, so
+ * any number of commands may be in flight at once, and commands of the same class and ID are matched oldest first.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+class AckTracker{
+public:
+	enum class Result : uint8_t{
+		ACK,		// UBX-ACK-ACK received.
+		NAK,		// UBX-ACK-NAK received.
+		TIMEOUT,	// No response by the deadline, after all retries.
+		CANCELLED,	// Removed by cancel() or clear().
+		UNSENT		// Never in flight: not transmitted or the table was full. Reported by senders, not the tracker.
+	};
+
+	typedef void (*Callback)(uint8_t msgClass, uint8_t msgID, Result result, void * ctx);
+	typedef bool (*Resend)(void * ctx);	// Retransmits the command. False if it could not be sent.
+
+	struct Request{
+		uint8_t msgClass = 0u;
+		uint8_t msgID = 0u;
+		uint8_t retries = 0u;			// Retransmissions remaining upon timeout.
+		uint32_t timeout = 1000u;		// Time allowed for each attempt [ms].
+		Callback done = nullptr;		// Called once upon completion. May be nullptr.
+		Resend resend = nullptr;		// Required for retries.
+		void * ctx = nullptr;			// Given to done and resend.
+	};
+
+	typedef uint8_t Token;				// Identifies a request in flight.
+	static const uint8_t capacity = 16u;
+	static const Token none = 0xFFu;	// Returned when the table is full.
+
+	Token submit(const Request & r, uint32_t now);
+	bool resolve(bool ack, uint8_t msgClass, uint8_t msgID);	// True if a request in flight was matched.
+	void service(uint32_t now);
+
+	bool pending(Token t) const;
+	void cancel(Token t);
+	void clear();
+
+	inline uint8_t inFlight() const { return count; }
+	inline bool full() const { return count >= capacity; }	// submit() would refuse a request.
+
+private:
+	struct Entry{
+		Request r;
+		uint32_t deadline;
+		uint16_t seq;		// Order of submission, for matching the oldest first.
+		bool active;
+	};
+
+	Entry table[capacity] = {};
+	uint16_t seq = 0u;
+	uint8_t count = 0u;
+
+	void finish(Entry & e, Result result);
+};
+
+/*** END OF FILE ***/
@@ -0,0 +1,183 @@
+/**
+  ******************************************************************************
+  * @file			: CivilTime.hpp
+  * @brief			: Constant Expression Civil (UTC) and GPS Time Conversions
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage:
+ * Every conversion is a constexpr function of integers only, in place of mktime(), which depends on the local time
+ * zone and may allocate. Dates are proleptic Gregorian, with 1-based months and days, as given by the receiver.
+ *
+ * 	CivilTime::epoch(2022, 12, 9, 9, 23, 0)			UNIX time [s] of 2022-12-09 09:23:00 UTC.
+ * 	CivilTime::epochMs(2022, 12, 9, t.daytime())		The same [ms], with the milliseconds of an NMEA time of day.
+ * 	CivilTime::gps(ms)								GPS week and time of week of a UNIX time [ms].
+ * 	CivilTime::epochMs(gps)							The reverse.
+ *
+ * GPS time runs ahead of UTC by the leap seconds inserted since the GPS epoch (1980-01-06), taken from leapDays. Where
+ * the receiver gives the current leap second count (e.g. PUBX,04) it may be passed in place of the table. A leap
+ * second itself (23:59:60) has no UNIX time, and is given that of the following second.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+class CivilTime{
+public:
+	struct Date{
+		int32_t year;
+		uint8_t month;	// 1..12
+		uint8_t day;	// 1..31
+	};
+
+	struct GpsTime{
+		uint16_t week;	// Weeks since 1980-01-06, not rolled over at 1024.
+		uint32_t tow;	// Time of Week [ms]
+	};
+
+	static constexpr int64_t msPerDay = 86400000;
+	static constexpr int64_t msPerWeek = 7 * msPerDay;
+	static constexpr int32_t gpsEpochDays = 3657;	// 1980-01-06, in days since 1970-01-01.
+
+	/**
+	 * @brief Days since 1970-01-01 of a date. Negative before.
+	 *
+	 * @note After H. Hinnant, "chrono-Compatible Low-Level Date Algorithms", counting from eras of 400 years
+	 * beginning in March, so that the leap day falls last.
+	 */
+	static constexpr int32_t daysFromCivil(int32_t y, uint8_t m, uint8_t d){
+		y -= (m <= 2u) ? 1 : 0;
+		const int32_t era = ( (y >= 0) ? y : y - 399 ) / 400;
+		const uint32_t yoe = static_cast<uint32_t>(y - era * 400);							// [0, 399]
+		const uint32_t doy = (153u * ( (m > 2u) ? m - 3u : m + 9u ) + 2u) / 5u + d - 1u;	// [0, 365]
+		const uint32_t doe = yoe * 365u + yoe / 4u - yoe / 100u + doy;						// [0, 146096]
+		return era * 146097 + static_cast<int32_t>(doe) - 719468;
+	}
+
+	/**
+	 * @brief The date of a number of days since 1970-01-01. The inverse of daysFromCivil().
+	 */
+	static constexpr Date civilFromDays(int32_t z){
+		z += 719468;
+		const int32_t era = ( (z >= 0) ? z : z - 146096 ) / 146097;
+		const uint32_t doe = static_cast<uint32_t>(z - era * 146097);				// [0, 146096]
+		const uint32_t yoe = (doe - doe / 1460u + doe / 36524u - doe / 146096u) / 365u;	// [0, 399]
+		const uint32_t doy = doe - (365u * yoe + yoe / 4u - yoe / 100u);			// [0, 365]
+		const uint32_t mp = (5u * doy + 2u) / 153u;									// [0, 11], from March.
+		const uint8_t d = static_cast<uint8_t>(doy - (153u * mp + 2u) / 5u + 1u);
+		const uint8_t m = static_cast<uint8_t>( (mp < 10u) ? mp + 3u : mp - 9u );
+		return Date{ static_cast<int32_t>(yoe) + era * 400 + ( (m <= 2u) ? 1 : 0 ), m, d };
+	}
+
+	/**
+	 * @brief UNIX time [s] of a UTC date and time.
+	 */
+	static constexpr int64_t epoch(int32_t year, uint8_t month, uint8_t day, uint8_t hh, uint8_t mm, uint8_t ss){
+		return static_cast<int64_t>(daysFromCivil(year, month, day)) * 86400 + (hh * 60 + mm) * 60 + ss;
+	}
+
+	/**
+	 * @brief UNIX time [ms] of a UTC date and time of day [ms].
+	 */
+	static constexpr int64_t epochMs(int32_t year, uint8_t month, uint8_t day, uint32_t daytime){
+		return static_cast<int64_t>(daysFromCivil(year, month, day)) * msPerDay + daytime;
+	}
+
+	/**
+	 * @brief GPS - UTC [s] at a UNIX time [s], from leapDays.
+	 */
+	static constexpr uint8_t leapSeconds(int64_t t){
+		uint8_t n = 0u;
+		while( (n < leapCount) && (static_cast<int64_t>(leapDays[n]) * 86400 <= t) ) n++;
+		return n;
+	}
+
+	/**
+	 * @brief GPS week and time of week of a UNIX time [ms], with leap seconds given or from leapDays.
+	 */
+	static constexpr GpsTime gps(int64_t ms, int16_t leap = -1){
+		if(leap < 0) leap = leapSeconds( floorDiv(ms, 1000) );
+		const int64_t g = ms - static_cast<int64_t>(gpsEpochDays) * msPerDay + leap * 1000;
+		return GpsTime{ static_cast<uint16_t>(g / msPerWeek), static_cast<uint32_t>(g % msPerWeek) };
+	}
+
+	/**
+	 * @brief UNIX time [ms] of a GPS week and time of week, with leap seconds given or from leapDays.
+	 */
+	static constexpr int64_t epochMs(GpsTime g, int16_t leap = -1){
+		const int64_t t = static_cast<int64_t>(gpsEpochDays) * msPerDay + g.week * msPerWeek + g.tow;	// Before leap seconds.
+		if(leap < 0){	// Each leap second is reached on the GPS time scale once the earlier ones have passed.
+			leap = 0;
+			while( (leap < leapCount) && ( (static_cast<int64_t>(leapDays[leap]) * 86400 + leap + 1) * 1000 <= t ) ) leap++;
+		}
+		return t - leap * 1000;
+	}
+
+private:
+	static constexpr uint8_t leapCount = 18u;
+	static constexpr uint16_t leapDays[leapCount] = {	// Days since 1970-01-01 beginning after each leap second.
+		4199u,	// 1981-07-01
+		4564u,	// 1982-07-01
+		4929u,	// 1983-07-01
+		5660u,	// 1985-07-01
+		6574u,	// 1988-01-01
+		7305u,	// 1990-01-01
+		7670u,	// 1991-01-01
+		8217u,	// 1992-07-01
+		8582u,	// 1993-07-01
+		8947u,	// 1994-07-01
+		9496u,	// 1996-01-01
+		10043u,	// 1997-07-01
+		10592u,	// 1999-01-01
+		13149u,	// 2006-01-01
+		14245u,	// 2009-01-01
+		15522u,	// 2012-07-01
+		16617u,	// 2015-07-01
+		17167u	// 2017-01-01
+	};
+
+	static constexpr int64_t floorDiv(int64_t a, int64_t b){ return (a >= 0) ? a / b : -( (b - 1 - a) / b ); }
+};
+
+static_assert(CivilTime::daysFromCivil(1980, 1, 6) == CivilTime::gpsEpochDays, "GPS epoch");
+static_assert(CivilTime::daysFromCivil(2017, 1, 1) == 17167, "Last leap second");
+static_assert(CivilTime::epoch(2022, 12, 9, 9, 23, 0) == 1670577780, "UNIX time");
+static_assert(CivilTime::civilFromDays(11016).year == 2000 && CivilTime::civilFromDays(11016).day == 29, "Leap day");
+static_assert(CivilTime::gps(1670577780000).week == 2239 && CivilTime::gps(1670577780000).tow == 465798000u, "GPS week");
+static_assert(CivilTime::epochMs(CivilTime::gps(1670577780000)) == 1670577780000, "GPS round trip");
+
+static_assert([]{	// Every day of a leap year.
+	for(int32_t z = CivilTime::daysFromCivil(2024, 1, 1); z < CivilTime::daysFromCivil(2025, 1, 1); z++){
+		const CivilTime::Date d = CivilTime::civilFromDays(z);
+		if(CivilTime::daysFromCivil(d.year, d.month, d.day) != z) return false;
+	}
+	return true;
+}(), "Date round trip");
+
+static_assert([]{	// The second before and after each leap second, which may only fall at the end of June or December.
+	uint8_t boundaries = 0u;
+	for(int32_t h = 1980 * 2; h <= 2017 * 2; h++){	// Each 1st of January and July.
+		const int64_t t = static_cast<int64_t>(CivilTime::daysFromCivil(h / 2, (h % 2) ? 7u : 1u, 1u)) * 86400;
+		if(CivilTime::leapSeconds(t) == CivilTime::leapSeconds(t - 1)) continue;
+		const CivilTime::GpsTime before = CivilTime::gps( (t - 1) * 1000 ), after = CivilTime::gps(t * 1000);
+		if( (CivilTime::epochMs(before) != (t - 1) * 1000) || (CivilTime::epochMs(after) != t * 1000) ) return false;
+		if( (after.week - before.week) * CivilTime::msPerWeek + after.tow - before.tow != 2000 ) return false;	// 23:59:60 between.
+		boundaries++;
+	}
+	return boundaries == 18u;
+}(), "GPS round trip at each leap second");
+
+/*** END OF FILE ***/
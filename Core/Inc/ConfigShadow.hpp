@@ -0,0 +1,67 @@
+/**
+  ******************************************************************************
+  * @file			: ConfigShadow.hpp
+  * @brief			: Local Copy of Receiver Configuration Values
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage:
+ * The shadow holds the last known value of each configuration key, as polled from the receiver (CFG-VALGET) or as
+ * acknowledged after being set (CFG-VALSET). A profile of key-value pairs can then be reduced to the pairs whose values
+ * differ from the receiver's, so that only those need be sent.
+ *
+ * hash() gives a digest of a whole profile. An application which persists the digest of the profile last applied
+ * (e.g. in an RTC backup register) can skip both the poll and the set on the next boot if the profile is unchanged.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "UBX_CFG.hpp"
+
+class ConfigShadow{
+public:
+	using KeyValuePair = UBX::CFG::VAL::KeyValuePair;
+
+	static const uint8_t capacity = 64u;	// Keys held at once.
+
+	bool lookup(UBX::X4 key, UBX::U4 & value) const;
+	bool store(UBX::X4 key, UBX::U4 value);	// False if full.
+	void clear();
+
+	inline bool matches(const KeyValuePair & kv) const {
+		UBX::U4 v;
+		return lookup(kv.keyId.toKey(), v) && (v == kv.raw());
+	}
+
+	inline uint8_t size() const { return count; }
+
+	static uint32_t hash(const KeyValuePair * first, const KeyValuePair * last);
+
+private:
+	static const uint8_t slots = 2u * capacity;	// Open addressing, at most half full. Power of 2.
+	static_assert((slots & (slots - 1u)) == 0u, "Slot count must be a power of 2.");
+
+	struct Entry{
+		UBX::X4 key;	// 0 if empty. No valid key is 0.
+		UBX::U4 value;
+	} table[slots] = {};
+	uint8_t count = 0u;
+
+	static inline uint8_t slot(UBX::X4 key) { return static_cast<uint8_t>( (key * 2654435761u) >> 25 ) & (slots - 1u); }
+};
+
+/*** END OF FILE ***/
@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file			: FixFusion.hpp
+  * @brief			: One Fix per Epoch, Merged from GGA, RMC and VTG Sentences
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage:
+ * Each GGA, RMC and VTG sentence is passed to receive(). Sentences with the same UTC time of day are merged into one
+ * Fix in a back record, which becomes current() in a single write once every sentence in the required set has been
+ * merged. A sentence with a new time starts a new record, discarding one left incomplete. VTG carries no time and is
+ * merged into the record being assembled.
+ *
+ * GGA and RMC together carry the position, altitude, fix quality, speed, course and date of each epoch, so GLL and
+ * ZDA need not be output.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "NMEA_Standard.hpp"
+
+class FixFusion{
+public:
+	enum Part : uint8_t{
+		GGA = 0x01u,
+		RMC = 0x02u,
+		VTG = 0x04u
+	};
+
+	struct Fix{
+		NMEA_Standard::ZDA::UTC_DateTime time;	// Date is 0 without an RMC.
+		int32_t lat;		// [deg x 1e7]
+		int32_t lon;		// [deg x 1e7]
+		int32_t alt;		// Above Mean Sea Level [mm] (GGA)
+		int32_t sep;		// Geoid Separation [mm] (GGA)
+		uint16_t hdop;		// x 100 (GGA)
+		int32_t speed;		// Over Ground [mm/s] (RMC or VTG)
+		int32_t course;		// Over Ground, True [deg x 1e5] (RMC or VTG)
+		uint8_t quality;	// GGA Fix Quality. 0 if no fix.
+		uint8_t numSV;		// Satellites used (GGA)
+		char status;		// RMC Status. 'A' Valid, 'V' Invalid.
+		char posMode;		// RMC or VTG Mode Indicator
+		uint8_t parts;		// Sentences merged.
+	};
+
+	FixFusion(uint8_t required = GGA | RMC) : required(required) {}
+
+	bool receive(const NMEA_Standard::GGA & gga);	// True if the record was completed and made current.
+	bool receive(const NMEA_Standard::RMC & rmc);
+	bool receive(const NMEA_Standard::VTG & vtg);
+
+	inline const Fix & current() const { return fixes[front]; }
+	inline uint16_t incomplete() const { return dropped; }	// Records discarded before completion.
+
+private:
+	enum class State : uint8_t{
+		IDLE,		// No record.
+		OPEN,		// Back record being assembled.
+		DONE		// Record made current. Further sentences of its time are ignored.
+	};
+
+	const uint8_t required;
+
+	Fix fixes[2] = {};
+	volatile uint8_t front = 0u;	// Index of current(). The other record is the back record.
+
+	State state = State::IDLE;
+	uint32_t daytime = 0u;	// Of the back record [ms].
+	uint16_t dropped = 0u;
+
+	Fix * at(uint32_t t);
+	bool merged(uint8_t part);
+};
+
+/*** END OF FILE ***/
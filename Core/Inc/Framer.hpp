@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file			: Framer.hpp
+  * @brief			: Resumable NMEA / UBX Frame Identification State Machine
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage:
+ * The framer is fed a view of the unread Rx data, starting at the Rx read index. Each call to next() continues from
+ * the last character examined and returns once a complete, checksum-verified frame is found. Once next() returns
+ * false, release() gives the number of leading characters which are no longer needed (everything before a partial
+ * frame) and rebases the framer. The caller must then consume exactly that many characters from the Rx data before
+ * calling next() again with a fresh view.
+ *
+ * Every character is examined exactly once, in constant time, and partial frames are carried across calls. Between
+ * frames and within NMEA sentences, characters are examined a block at a time by the kernels in Scan.hpp.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include "RingBuffer.hpp"
+
+class Framer{
+public:
+	enum class Protocol : uint8_t{
+		NMEA,
+		UBX
+	};
+
+	struct Frame{
+		Protocol protocol;
+		uint16_t begin;	// Index of the first frame character in the scanned view.
+		uint16_t size;	// Number of characters in the frame, including start and end delimiters.
+	};
+
+	struct Statistics{
+		uint32_t nmea;		// Valid NMEA sentences framed.
+		uint32_t ubx;		// Valid UBX frames framed.
+		uint32_t errors;	// Frames discarded for checksum, length or character errors.
+	};
+
+	static const uint16_t maxNmea = 512u;		// Longest accepted NMEA sentence, including "$" and "\r\n". PUBX,03 exceeds 82.
+	static const uint16_t maxUbxPayload = 512u;	// Longest accepted UBX payload.
+	static const uint16_t maxFrame = (maxUbxPayload + 8u > maxNmea) ? maxUbxPayload + 8u : maxNmea;
+
+	bool next(const SegmentedView & v, Frame & f);
+	uint16_t release();
+	void reset();
+
+	inline const Statistics & statistics() const { return stats; }
+
+private:
+	enum class State : uint8_t{
+		IDLE,
+		NMEA_BODY,
+		NMEA_CK1,
+		NMEA_CK2,
+		NMEA_CR,
+		NMEA_LF,
+		UBX_SYNC2,
+		UBX_CLASS,
+		UBX_ID,
+		UBX_LEN1,
+		UBX_LEN2,
+		UBX_PAYLOAD,
+		UBX_CKA,
+		UBX_CKB
+	} state = State::IDLE;
+
+	uint16_t pos = 0u;			// Next character to be examined, relative to the view start.
+	uint16_t start = 0u;		// First character of the frame in progress.
+	uint16_t remaining = 0u;	// UBX payload characters still expected.
+	uint8_t ckA = 0u;			// UBX Fletcher A, or the running NMEA XOR checksum.
+	uint8_t ckB = 0u;			// UBX Fletcher B, or the received NMEA checksum.
+
+	Statistics stats{};
+
+	bool step(uint8_t c);		// Advances the state machine by one character. True if c completed a frame.
+	bool begin(uint8_t c);		// Examines c as a potential start of frame.
+	bool fail(uint8_t c);		// Discards the frame in progress and re-examines c as a potential start of frame.
+	uint16_t skip(const SegmentedView & v) const;	// Number of characters from pos which cannot start a frame.
+	uint16_t body(const SegmentedView & v);			// Number of characters from pos accepted into the NMEA body.
+	inline void fletcher(uint8_t c) { ckA += c; ckB += ckA; }
+
+	static int8_t hex(uint8_t c);
+};
+
+/*** END OF FILE ***/
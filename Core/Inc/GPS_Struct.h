@@ -19,20 +19,29 @@
 #ifndef SRC_GPS_STRUCT_H_
 #define SRC_GPS_STRUCT_H_
 
+#include <stdint.h>
+
 /*
  * Coordinate Object
  *
- * Stores the Cordinates of GPS in the form DDMM.mmmm
- * where DD - Degrees
- * 	     MM - Minutes
- * 	   mmmm - Fractional minutes
+ * Stores the Cordinates of GPS as integer degrees x 1e7 (about 1 cm), negative South and West. All members are
+ * integers, decoded directly from the receiver's digits, so that no floating point is needed to publish them.
+ *
  * Variables:	Name.............Type.................................Description
- * 				lat..............float32_t............................GPS Lattitude
- * 				longi............float32_t............................GPS Longitude
+ * 				lat..............int32_t..............................GPS Lattitude [deg x 1e7]
+ * 				longi............int32_t..............................GPS Longitude [deg x 1e7]
+ * 				alt..............int32_t..............................Altitude above Mean Sea Level [mm]
+ * 				speed............int32_t..............................Speed over Ground [mm/s]
+ * 				course...........int32_t..............................Course over Ground, True [deg x 1e5]
+ * 				time.............uint32_t.............................UNIX Epoch Time of the Fix, UTC [s]
+ * 				tic..............uint32_t.............................HAL Tick at Reception [ms]
  */
 typedef struct{
-	float lat;
-	float longi;
+	int32_t lat;
+	int32_t longi;
+	int32_t alt;
+	int32_t speed;
+	int32_t course;
 	uint32_t time;
 	uint32_t tic;
 }Coord_t;
@@ -41,20 +50,12 @@ typedef struct{
  * DOP Object
  *
  * Dilation of Precision is a metric of how the elevation, satelite number and satelite spread
- * affects the accuracy of the signal. This object allows for the conversion and storage of a
- * 32 bit float value representing a DOP into an 8 bit digit and 8 bit precision the range of
- * values outputted from the GPS is between 0,0 and 99.9. This will allow for accuracy up to 2
- * decimal places.
- *
- * Variables:	Name.............Type.................................Description
- * 				digit............uint8_t..............................8 bit representation of the whole number
- * 				precision........uint8_t..............................2 significant places representation of the fraction
+ * affects the accuracy of the signal. The receiver gives DOPs between 0.00 and 99.99 to 2 decimal
+ * places, which are held exactly as an integer number of hundredths.
  *
+ * e.g. A PDOP of 1.94 is held as 194.
  */
-typedef struct{
-	int digit;
-	int precision;
-}DOP_t;
+typedef uint16_t DOP_t;	// DOP x 100
 
 /*
  * Diagnostic Object
@@ -65,8 +66,9 @@ typedef struct{
  * 				PDOP.............DOP_t................................Positional Dilation of Precision (3D)
  * 				HDOP.............DOP_t................................Horizontal Dilation of Precision
  * 				VDOP.............DOP_t................................Vertical   Dilation of Precision
- * 				num_sats.........uint8_t..............................Number of Satelites used to obtain positional Fix
+ * 				num_sats.........uint8_t..............................Number of Satelites tracked (GSV) or used to obtain positional Fix (NAV-PVT)
  * 				fix_type.........uint8_t..............................number between 1-3 describing the type of fix obtained
+ * 				fix_quality......uint8_t..............................GGA fix quality (0 None, 1 Autonomous, 2 Differential, 4/5 RTK, 6 Dead Reckoning)
  *
  * Fix types
  * 1 - No Fix
@@ -78,8 +80,9 @@ typedef struct{
 	DOP_t PDOP;
 	DOP_t HDOP;
 	DOP_t VDOP;
-	int num_sats;
-	int fix_type;
+	uint8_t num_sats;
+	uint8_t fix_type;
+	uint8_t fix_quality;
 
 	uint32_t time;
 }Diagnostic_t;
@@ -94,6 +94,7 @@ public:
 
 protected:
 	Baud baud {Baud::B38400};	// Assumed MCU Baudrate initialised to 38400.
+	static const uint32_t drainTimeout = 1000u;	// Time allowed for transmissions to complete before a baudrate change [ms].
 
 public:
 	/*****************************************************************************************************************************/
@@ -118,6 +119,16 @@ public:
 	 */
 	virtual void delay(uint32_t delay) = 0;
 
+	/**
+	 * @brief Wait until every message transmitted has completely left the communication interface.
+	 * 
+	 * @param timeout	Time allowed in milliseconds.
+	 * @return false if transmission had not completed by the timeout.
+	 * 
+	 * @note Called before setBaudrate, which would otherwise abort the command that instructed the baudrate change.
+	 */
+	virtual bool drain(uint32_t timeout) = 0;
+
 	/**
 	 * @brief Set the baudrate of the relevant communication peripheral device.
 	 * 
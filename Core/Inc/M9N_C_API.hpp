@@ -20,6 +20,16 @@
 
 #include "M9N_STM32.hpp"
 #include "GPS_Struct.h"
+#include "UBX_NAV.hpp"
+
+/**
+ * Update Rate:
+ * GPS_UpdateRate_Config() sets the measurement period to GPS_UPDATE_PERIOD milliseconds, with one navigation solution
+ * per measurement.
+ */
+#ifndef GPS_UPDATE_PERIOD
+#define GPS_UPDATE_PERIOD 1000u
+#endif
 
 extern M9N m9n;
 
@@ -97,7 +107,12 @@ extern "C" void GPS_InterruptsOn();
 
 void receiveGLL(const NMEA_Standard::GLL & gll);
 void receiveGSA(const NMEA_Standard::GSA & gsa);
+void receiveGSV(const SatelliteTable & sats);
+void receiveFix(const FixFusion::Fix & fix);
 void receiveZDA(const NMEA_Standard::ZDA & zda);
+void receivePVT(const UBX::NAV::PVT & pvt);
+void receivePUBX(const M9N_Base::NMEA_PUBX::Position & position);
+void receivePUBX(const M9N_Base::NMEA_PUBX::Time & time);
 
 
 /*** END OF FILE ***/
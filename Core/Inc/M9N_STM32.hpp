@@ -19,37 +19,147 @@
 #pragma once
 
 #include "M9N_Base.hpp"
+#include "AckTracker.hpp"
+#include "ConfigShadow.hpp"
+#include "FixFusion.hpp"
+#include "Framer.hpp"
+#include "SatelliteTable.hpp"
 #include "UART.hpp"
 
 #include "stm32l4xx_hal.h"
 
+#include <array>
 #include <string>
 
 using string = StaticString;
 
+/**
+ * NAV-PVT Mode:
+ * When M9N_NAV_PVT is defined non-zero, init() configures the receiver to output UBX-NAV-PVT on UART1 in place of the
+ * GLL, GSA and ZDA sentences. A single binary frame then carries the position, fix and time of each epoch, and is
+ * published to the C API without any text parsing. NAV-PVT frames are published whenever received regardless.
+ */
+#ifndef M9N_NAV_PVT
+#define M9N_NAV_PVT 0
+#endif
+
+/**
+ * PUBX Mode:
+ * When M9N_PUBX is defined non-zero (and M9N_NAV_PVT is not), init() configures the receiver to output only PUBX,00
+ * each epoch, which alone carries the position, altitude, accuracy, speed, DOPs and satellite count, with PUBX,04 once
+ * every pubxTimeInterval epochs for the date. For links on which UBX binary output cannot be used.
+ */
+#ifndef M9N_PUBX
+#define M9N_PUBX 0
+#endif
+
+/**
+ * Baudrate Escalation:
+ * When M9N_MAX_BAUD is defined as one of the Baud values, init() steps the link up from 38400 Bd through each faster
+ * Baud value up to M9N_MAX_BAUD, stopping at the fastest which is verified to be stable. 10 Hz output of several
+ * constellations needs more than 38400 Bd. When 0, the link is left at 38400 Bd.
+ */
+#ifndef M9N_MAX_BAUD
+#define M9N_MAX_BAUD 0
+#endif
+
+/**
+ * Autobaud:
+ * When M9N_AUTOBAUD is defined non-zero, init() first discovers the receiver's baudrate with autobaud() instead of
+ * assuming 38400 Bd, so that the link is recovered after a partial reconfiguration or a brown-out. Discovery takes
+ * up to autobaudWindow ms for each Baud value tried.
+ */
+#ifndef M9N_AUTOBAUD
+#define M9N_AUTOBAUD 0
+#endif
+
 class M9N : public M9N_Base{
 public:
 	M9N(UART_HandleTypeDef * h, IRQn_Type uartIrq, IRQn_Type dmaTxIrq, IRQn_Type dmaRxIrq);
-	void init();
+	AckTracker::Result init(uint32_t * digest = nullptr);
 
 	void scanMessages();
 	inline bool dataReady(){ return uart.rx.dataReady(); }
+	inline const Framer::Statistics & statistics() const { return framer.statistics(); }
+	inline uint16_t overruns() const { return uart.rx.overruns(); }	// Rx characters lost before framing.
+	inline const SatelliteTable & satellites() const { return sky; }	// Assembled from GSV sentences.
+	inline const FixFusion & fix() const { return fusion; }				// Merged from GGA, RMC and VTG sentences.
+	static const uint8_t pubxTimeInterval = 60u;	// Epochs per PUBX,04 in PUBX mode. The date changes rarely.
 
 	inline void interruptsOn(){ uart.interruptsOn(); }
 	inline void interruptsOff(){ uart.interruptsOff(); }
+
+	/* Non-blocking Transmission */
+	template<typename M>
+	UART::Tx::Token post(const M & msg, UART::Tx::Notify done = nullptr, void * ctx = nullptr);
+	UART::Tx::Token post(const UBX::Encoded & msg, UART::Tx::Notify done = nullptr, void * ctx = nullptr);
+	UART::Tx::Token post(const uint8_t * first, const uint8_t * last, UART::Tx::Notify done = nullptr, void * ctx = nullptr,
+		UART::Tx::Lane lane = UART::Tx::Lane::BULK);
+	inline bool sent(UART::Tx::Token t) const { return uart.tx.sent(t); }
+	inline const UART::Tx::Statistics & txStatistics(UART::Tx::Lane l) const { return uart.tx.statistics(l); }
+
+	/* Acknowledged Configuration */
+	// M is a CFG-VALSET frame: UBX::CFG::VAL::SET or UBX::CFG::VAL::SET::TRANSACTION.
+	template<typename M>
+	AckTracker::Token send(const M & msg, AckTracker::Request r);	// Pipelined. Completes via r.done.
+	template<typename M>
+	AckTracker::Result sendAndWait(const M & msg, uint8_t retries = 2u, uint32_t timeout = 1000u);
+
+	AckTracker::Result configure(const UBX::CFG::VAL::KeyValuePair * first, const UBX::CFG::VAL::KeyValuePair * last,
+		UBX::CFG::VAL::SET::Layers layers = UBX::CFG::VAL::SET::Layers::RAM);
+	AckTracker::Result apply(const UBX::CFG::VAL::KeyValuePair * first, const UBX::CFG::VAL::KeyValuePair * last,
+		UBX::CFG::VAL::SET::Layers layers = UBX::CFG::VAL::SET::Layers::RAM, uint32_t * digest = nullptr);
+	AckTracker::Result poll(const UBX::CFG::VAL::KeyValuePair * first, const UBX::CFG::VAL::KeyValuePair * last,
+		UBX::CFG::VAL::GET::Layer layer = UBX::CFG::VAL::GET::Layer::RAM);
+
+	/* Baudrate */
+	struct Autobaud{
+		Baud baud;			// Baudrate in use afterwards.
+		bool locked;		// Valid frames were received at baud.
+		uint16_t frames;	// Valid frames received at baud.
+		uint32_t elapsed;	// Duration of the search [ms].
+	};
+	static const uint32_t autobaudWindow = 1200u;	// Longer than one epoch of output at the default 1 Hz [ms].
+
+	Autobaud autobaud(uint32_t window = autobaudWindow);	// Finds the receiver's baudrate by listening at each.
+	AckTracker::Result changeBaudrate(Baud to);		// Switches both ends and verifies the link. Reverts on failure.
+	Baud escalate(Baud ceiling = Baud::B921600);	// Steps up to the fastest stable baudrate. Returns the baudrate in use.
+	inline Baud baudrate() const { return baud; }
+
+	inline const AckTracker & pending() const { return acks; }
+	inline const ConfigShadow & configuration() const { return shadow; }
 	
 private:
 	UART uart;
+	Framer framer;
+	SatelliteTable sky;
+	FixFusion fusion;
+	AckTracker acks;
+	ConfigShadow shadow;
+	std::array<UBX::CFG::VAL::KeyValuePair, ConfigShadow::capacity> diffBuff;	// Pairs of a profile to be sent by apply().
+	std::array<uint8_t, Framer::maxFrame> linearBuff;	// Contiguous copy of a frame which wraps around the end of the Rx ring.
+
+	static const uint8_t probes = 3u;			// Polls which must all succeed for a link to be verified.
+	static const uint32_t probeTimeout = 500u;	// Time allowed for each poll [ms].
+	static const uint32_t baudSettle = 20u;		// Time allowed for the receiver to switch baudrate [ms].
+	static const uint8_t lockFrames = 2u;		// Valid frames without error upon which autobaud() locks in a baudrate.
+	UBX::U4 polledBaud = 0u;	// CFG-UART1-BAUDRATE as last polled. Kept apart from the shadow, which may be full.
+
+	AckTracker::Result switchBaudrate(Baud to);
+	AckTracker::Result probe();
 
 	inline void interpretNmea(const StaticString & s);
-	inline void interpretUBX(std::pair<uint8_t *, uint8_t *> v);
+	inline void interpretUBX(std::pair<const uint8_t *, const uint8_t *> v);
 
 	using M9N_Base::transmit;
 	virtual void transmit(const uint8_t * first, const uint8_t * last) final;
-	void transmit(UBX::CFG::VAL::SET set);
+	template<typename M>
+	bool transmit(const M & msg);
+	bool transmit(const UBX::Encoded & msg);
 	void transmit(UBX::CFG::VAL::GET get);
 
 	virtual void delay(uint32_t delay) final;
+	virtual bool drain(uint32_t timeout) final;
 	virtual void setBaudrate(Baud baud = Baud::B38400, PortID portId = PortID::UART1) final;
 
 
@@ -58,6 +168,88 @@ private:
 	friend void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
 };
 
+/**
+ * @brief Encodes the frame directly into the Tx buffer, without any intermediate copy.
+ * 
+ * @return false if the frame is larger than the Tx buffer, or timed out waiting for space.
+ */
+template<typename M>
+bool M9N::transmit(const M & msg){
+	const auto n = msg.frameSize();
+	auto p = uart.tx.alloc(n);
+	if(p == nullptr) return false;
+	uart.tx.transmit(msg.serialize(p));
+	return true;
+}
+
+/**
+ * @brief Encodes the frame into the Tx buffer only if there is space for it now. Never waits.
+ * 
+ * @param done	Called from the Tx complete interrupt once the frame has been transmitted. May be nullptr.
+ * @return UART::Tx::Token wouldBlock if the frame does not fit yet, in which case it should be posted again later.
+ */
+template<typename M>
+UART::Tx::Token M9N::post(const M & msg, UART::Tx::Notify done, void * ctx){
+	auto p = uart.tx.tryAlloc(msg.frameSize());
+	if(p == nullptr) return UART::Tx::wouldBlock;
+	return uart.tx.submit(msg.serialize(p), done, ctx);
+}
+
+/**
+ * @brief Transmits the frame and tracks its acknowledgement, without waiting.
+ * 
+ * @param r	Completion and retry policy. The class and ID are taken from msg. Retries require r.resend.
+ * @return AckTracker::Token none if the frame could not be transmitted or tracked, in which case r.done is not called.
+ * 
+ * @note Nothing is transmitted while every tracker slot is in use, as the receiver's response could not be matched.
+ */
+template<typename M>
+AckTracker::Token M9N::send(const M & msg, AckTracker::Request r){
+	r.msgClass = msg.getClass();
+	r.msgID = msg.getID();
+	if(acks.full() || !transmit(msg)) return AckTracker::none;
+	return acks.submit(r, HAL_GetTick());
+}
+
+/**
+ * @brief Transmits the frame and processes received data until it is acknowledged, rejected or timed out.
+ * 
+ * @param retries	Retransmissions upon timeout.
+ * @param timeout	Time allowed for each attempt [ms].
+ * 
+ * @note Reception must already have begun. Other messages received meanwhile are interpreted as usual.
+ */
+template<typename M>
+AckTracker::Result M9N::sendAndWait(const M & msg, uint8_t retries, uint32_t timeout){
+	struct Wait{
+		M9N * m9n;
+		const M * msg;
+		bool done;
+		AckTracker::Result result;
+	} w{this, &msg, false, AckTracker::Result::UNSENT};
+
+	AckTracker::Request r;
+	r.retries = retries;
+	r.timeout = timeout;
+	r.ctx = &w;
+	r.done = [](uint8_t, uint8_t, AckTracker::Result result, void * ctx){
+		auto w = static_cast<Wait *>(ctx);
+		w->result = result;
+		w->done = true;
+	};
+	r.resend = [](void * ctx){
+		auto w = static_cast<Wait *>(ctx);
+		return w->m9n->transmit(*w->msg);
+	};
+
+	if(send(msg, r) == AckTracker::none) return AckTracker::Result::UNSENT;
+	while(!w.done){
+		delay(1u);
+		scanMessages();	// Resolves and services the request.
+	}
+	return w.result;
+}
+
 /* Static Structures for Fetching Scanned Values */
 
 
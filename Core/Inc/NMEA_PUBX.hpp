@@ -111,4 +111,91 @@ public:
 	virtual string toString(char buff[40]) final;
 };
 
-/*** END OF FILE ***/
\ No newline at end of file
+class NMEA::Position : public PUBX{
+public:
+	enum class NavStatus : uint8_t{
+		NF,		// No Fix
+		DR,		// Dead Reckoning only
+		G2,		// Stand-alone 2D
+		G3,		// Stand-alone 3D
+		D2,		// Differential 2D
+		D3,		// Differential 3D
+		RK,		// Combined GNSS and Dead Reckoning
+		TT,		// Time only
+
+		UNKNOWN
+	};
+
+	UTC_Time time;
+	Coordinate lat;
+	Coordinate lon;
+	int32_t altRef;		// Altitude above User Datum Ellipsoid [mm]
+	NavStatus navStat;
+	int32_t hAcc;		// Horizontal Accuracy Estimate [mm]
+	int32_t vAcc;		// Vertical Accuracy Estimate [mm]
+	int32_t sog;		// Speed over Ground [m/h]
+	int32_t cog;		// Course over Ground [deg x 1e5]
+	int32_t vVel;		// Vertical Velocity, positive downwards [mm/s]
+	float diffAge;		// Age of Differential Corrections [s]
+	uint16_t hdop;		// Horizontal DOP x 100
+	uint16_t vdop;		// Vertical DOP x 100
+	uint16_t tdop;		// Time DOP x 100
+	uint8_t numSvs;		// Satellites used in the Navigation Solution
+	uint8_t dr;			// Dead Reckoning used (0 or 1)
+
+	Position(const Sentence & fields);
+	Position(const string & nmea);
+	virtual ~Position() = default;
+
+	virtual string toString(char *) final{return "";}	// Unimplemented
+private:
+	static NavStatus navStatus(const string & f);
+};
+
+/**
+ * @brief Status of every satellite tracked, in a single sentence of 6 fields per satellite.
+ * 
+ * @note Too long for Sentence, so fields are taken from the sentence one at a time.
+ */
+class NMEA::SvStatus : public PUBX{
+public:
+	struct Satellite{
+		uint8_t svid;		// Satellite ID (u-blox numbering)
+		char s;				// Status. 'U' Used, 'e' Ephemeris but not used, '-' Not used.
+		uint16_t az;		// Azimuth [deg]. 0 if unknown.
+		uint8_t el;			// Elevation [deg]. 0 if unknown.
+		uint8_t cno;		// Signal Strength (C/N0) [dBHz]. 0 if not tracked.
+		uint8_t lck;		// Carrier Lock Time [s]. 64 if 64 s or more.
+	};
+
+	static const uint8_t capacity = 24u;	// Satellites held. As many as fit in Framer::maxNmea.
+
+	uint8_t n;			// Satellites tracked
+	uint8_t count;		// Satellites held. 0 if the sentence is invalid.
+	std::array<Satellite, capacity> sv;
+
+	SvStatus(const string & nmea);
+	virtual ~SvStatus() = default;
+
+	virtual string toString(char *) final{return "";}	// Unimplemented
+};
+
+class NMEA::Time : public PUBX{
+public:
+	NMEA_Standard::ZDA::UTC_DateTime time;	// Time and Date. No local zone.
+	uint32_t utcTow;	// UTC Time of Week [ms]
+	uint16_t utcWk;		// UTC Week Number
+	uint8_t leapSec;	// Leap Seconds (GPS - UTC) [s]
+	bool leapDefault;	// leapSec is the firmware default rather than broadcast.
+	int32_t clkBias;	// Receiver Clock Bias [ns]
+	int32_t clkDrift;	// Receiver Clock Drift [ps/s]
+	uint16_t tpGran;	// Timepulse Granularity [ns]
+
+	Time(const Sentence & fields);
+	Time(const string & nmea);
+	virtual ~Time() = default;
+
+	virtual string toString(char *) final{return "";}	// Unimplemented
+};
+
+/*** END OF FILE ***/
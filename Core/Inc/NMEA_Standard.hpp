@@ -19,6 +19,7 @@
 #pragma once
 
 #include <array>
+#include <limits>
 #include <stdint.h>
 #include <time.h>
 
@@ -31,11 +32,14 @@ class NMEA_Standard{
 protected:
 	struct Address;
 	struct Checksum;
+	struct Field;
 
 public:
 	enum class TalkerID;
 	enum class Message;
 
+	class Sentence;
+
 	class DTM;
 	class GBS;
 	class GGA;
@@ -86,32 +90,62 @@ protected:
 	};
 
 	struct UTC_Time{
-		uint8_t hh;	// Hours
-		uint8_t mm;	// Minutes
-		float ss;	// Seconds (2 or 3 decimal points of precision)
+		uint8_t hh;		// Hours
+		uint8_t mm;		// Minutes
+		uint8_t ss;		// Seconds
+		uint16_t ms;	// Milliseconds (2 or 3 decimal points of precision given)
 
 		UTC_Time() = default;
 		UTC_Time(const string & tStr);
 		UTC_Time(const UTC_Time & t) = default;
 		string toString(char buff[9]);
 
-		time_t daytime() const;
+		uint32_t daytime() const;	// Milliseconds since midnight.
 
-		inline operator time_t() const { return daytime(); };
+		inline operator uint32_t() const { return daytime(); };
 	};
 
+	/**
+	 * @brief A latitude or longitude, decoded from (d)ddmm.mmmmm directly as an integer number of degrees x 1e7.
+	 * 
+	 * @note 1e-7 degrees is about 1 cm, finer than the 5 decimal places of minutes given by the receiver.
+	 */
 	struct Coordinate{
-		uint16_t deg;
-		float min;
-		char nsew;
+		int32_t deg7;	// Degrees x 1e7. Negative South and West.
 
 		Coordinate() = default;
 		Coordinate(const string & s, char nsew);
 		Coordinate(const Coordinate & c) = default;
 
-		string toString(char cStr[11]);
+		string toString(char cStr[12]);
 		
-		operator float() const;
+		inline operator int32_t() const { return deg7; }
+	};
+
+	/**
+	 * @brief Bounded decoders for numeric NMEA fields.
+	 * 
+	 * Fields are views into the sentence and are not NUL-terminated, so no character outside the field is read.
+	 * Each decoder returns false and leaves v unchanged if the field is empty or not entirely a number of that form.
+	 */
+	struct Field{
+		template<typename T>
+		static bool decimal(const string & f, T & v);	// Unsigned decimal integer.
+
+		template<typename T>
+		static bool hex(const string & f, T & v);		// Unsigned hexadecimal integer.
+
+		static bool fixed(const string & f, int32_t & mantissa, uint8_t & decimals);	// [+-]digits[.digits], as mantissa / 10^decimals.
+		static bool real(const string & f, float & v);	// Decimal number with an optional fractional part.
+
+		template<typename T>
+		static bool scaled(const string & f, uint8_t decimals, T & v);	// Decimal number x 10^decimals, truncated. Within T.
+
+		static int8_t digit(char c) { return ( (c >= '0') && (c <= '9') ) ? c - '0' : -1; }
+		static int8_t hexDigit(char c);
+
+		static const uint8_t maxDigits = 9u;	// Significant digits retained. 10^9 fits within int32_t.
+		static const int32_t pow10[maxDigits + 1];
 	};
 
 	NMEA_Standard() = default;	// Derived classes shall be responsible for all base member initialisation.
@@ -119,15 +153,26 @@ protected:
 	void setChecksum();	// Sets the checksum from the member toString representation.
 	
 	/* Static helper functions */
-	template<size_t N>
-	static std::array<StaticString, N> parseFields(const string & nmea);
-
 	static const string toString(const Message msg);
 	static const string toString(const TalkerID tId);
 
 	static Message getMessage(const StaticString & s);
 	static TalkerID getTalkerId(const StaticString & s);
 
+	/**
+	 * @brief Packs n (at most 4) identifier characters into an integer, the first character being most significant.
+	 * 
+	 * @note Identifiers are looked up by switching on the packed value, with case labels evaluated at compile time.
+	 */
+	static constexpr uint32_t pack(const char * s, size_t n){
+		uint32_t v = 0u;
+		for(size_t i = 0; i < n; i++) v = (v << 8) | static_cast<uint8_t>(s[i]);
+		return v;
+	}
+
+	template<size_t N>
+	static constexpr uint32_t pack(const char (&s)[N]){ return pack(s, N - 1); }
+
 									// Address can change for proprietary messages. Derived member.
 	const char start = '$';			// Start Character
 									// Payload defined in derived class.
@@ -171,6 +216,80 @@ enum class NMEA_Standard::Message{
 	UNKNOWN
 };
 
+template<typename T>
+bool NMEA_Standard::Field::decimal(const string & f, T & v){
+	if(f.empty() || (f.size() > maxDigits)) return false;
+
+	uint32_t n = 0u;
+	for(auto c : f){
+		const auto d = digit(c);
+		if(d < 0) return false;
+		n = n * 10u + d;
+	}
+	v = static_cast<T>(n);
+	return true;
+}
+
+template<typename T>
+bool NMEA_Standard::Field::hex(const string & f, T & v){
+	if(f.empty() || (f.size() > 2 * sizeof(uint32_t))) return false;
+
+	uint32_t n = 0u;
+	for(auto c : f){
+		const auto d = hexDigit(c);
+		if(d < 0) return false;
+		n = (n << 4) | d;
+	}
+	v = static_cast<T>(n);
+	return true;
+}
+
+template<typename T>
+bool NMEA_Standard::Field::scaled(const string & f, uint8_t decimals, T & v){
+	int32_t m;
+	uint8_t d;
+	if( !fixed(f, m, d) || (decimals > maxDigits) ) return false;
+
+	if(d > decimals) m /= pow10[d - decimals];
+	else if(d < decimals){
+		const int32_t k = pow10[decimals - d];
+		if( (m > INT32_MAX / k) || (m < INT32_MIN / k) ) return false;
+		m *= k;
+	}
+	if( (m < static_cast<int64_t>(std::numeric_limits<T>::min())) || (m > static_cast<int64_t>(std::numeric_limits<T>::max())) )
+		return false;	// Not representable in T, such as a negative DOP.
+	v = static_cast<T>(m);
+	return true;
+}
+
+/**
+ * @brief A verified NMEA sentence, split into its comma-delimited fields.
+ * 
+ * The sentence is scanned once upon construction, accumulating the checksum, recording the field offsets and
+ * verifying the trailing "*hh". Fields are views into the original sentence. An invalid sentence has no fields.
+ */
+class NMEA_Standard::Sentence{
+public:
+	static const uint8_t maxFields = 32u;	// Including the address field.
+
+	Sentence(const string & nmea);
+	Sentence(const string & nmea, bool verified);	// If verified, the checksum has already been verified, as by Framer, and is only read.
+
+	inline bool valid() const { return n > 0u; }
+	inline uint8_t size() const { return n; }
+	inline uint8_t checksum() const { return cs; }
+
+	inline string operator [](uint8_t i) const {
+		return (i < n) ? s.substr(begin[i], begin[i+1] - 1u - begin[i]) : string();
+	}
+
+private:
+	string s;
+	uint8_t n;						// Number of fields. 0 if the sentence is invalid.
+	uint8_t cs;						// Verified checksum.
+	uint8_t begin[maxFields + 1];	// Offset of the first character of each field, then one past the '*'.
+};
+
 class NMEA_Standard::GNS : public NMEA_Standard{
 private:
 	struct PosMode{
@@ -193,19 +312,40 @@ private:
 	Coordinate lon;	// Longitude
 	PosMode posMode;	// Positioning Mode
 	uint8_t numSV;	// Number of Satellites
-	float hdop;	// Horizontal Dilution of Precision
-	float alt;	// Altitude
-	float sep;	// Geoid Separation
+	uint16_t hdop;	// Horizontal Dilution of Precision x 100
+	int32_t alt;	// Altitude [mm]
+	int32_t sep;	// Geoid Separation [mm]
 	float diffAge;	// Age of Differential Corrections
 	uint16_t diffStation;	// Differential Correction Station ID
 	char navStatus;	// Navigational Status Indicator
 	
 public:
-	GNS(const std::array<StaticString, 15> & fields);
+	GNS(const Sentence & fields);
 	GNS(const string & nmea);
 	virtual ~GNS() = default;
 
-	virtual string toString() final { return ""; }	// Unimplemented
+	virtual string toString(char *) final{return "";}	// Unimplemented
+};
+
+class NMEA_Standard::GGA : public NMEA_Standard{
+public:
+	Address addr;
+	UTC_Time time;
+	Coordinate lat;
+	Coordinate lon;
+	uint8_t quality;	// Fix Quality (0 No Fix, 1 Autonomous, 2 Differential, 4 RTK Fixed, 5 RTK Float, 6 Dead Reckoning)
+	uint8_t numSV;		// Number of Satellites used
+	uint16_t hdop;		// Horizontal DOP x 100
+	int32_t alt;		// Altitude above Mean Sea Level [mm]
+	int32_t sep;		// Geoid Separation [mm]
+	float diffAge;		// Age of Differential Corrections [s]
+	uint16_t diffStation;	// Differential Correction Station ID
+
+	GGA(const Sentence & fields);
+	GGA(const string & nmea);
+	virtual ~GGA() = default;
+
+	virtual string toString(char *) final{return "";}	// Unimplemented
 };
 
 class NMEA_Standard::GLL : public NMEA_Standard{
@@ -219,7 +359,7 @@ public:
 	char status;
 	char posMode;
 
-	GLL(const std::array<StaticString, 9> & fields);
+	GLL(const Sentence & fields);
 	GLL(const string & nmea);
 	virtual string toString(char *) final{return "";}
 };
@@ -230,18 +370,48 @@ public:
 	char opMode;	// Operational Mode ('M' or 'A')
 	uint8_t navMode;	// Navigation Mode
 	std::array<uint8_t, 12> svid;	// Satellite Numbers
-	float pdop;	// Position DOP
-	float hdop;	// Horizontal DOP
-	float vdop;	// Vertical DOP
+	uint16_t pdop;	// Position DOP x 100
+	uint16_t hdop;	// Horizontal DOP x 100
+	uint16_t vdop;	// Vertical DOP x 100
 	uint8_t systemId;	// GNSS System ID
 
-	GSA(const std::array<StaticString, 20> & fields);
+	GSA(const Sentence & fields);
 	GSA(const string & nmea);
 	virtual ~GSA() = default;
 
 	virtual string toString(char *) final{return "";}	// Unimplemented
 };
 
+/**
+ * @brief One sentence of a GSV group. A group of numMsg sentences lists the numSV satellites in view of one talker,
+ * four per sentence, and (NMEA 4.10 and later) for one signal.
+ */
+class NMEA_Standard::GSV : public NMEA_Standard{
+public:
+	struct Satellite{
+		uint8_t svid;		// Satellite ID
+		uint8_t elv;		// Elevation [deg]. 0 if unknown.
+		uint16_t az;		// Azimuth [deg]. 0 if unknown.
+		uint8_t cno;		// Signal Strength (C/N0) [dBHz]. 0 if not tracked.
+	};
+
+	static const uint8_t perSentence = 4u;
+
+	Address addr;
+	uint8_t numMsg;		// Number of sentences in the group
+	uint8_t msgNum;		// Number of this sentence, from 1
+	uint8_t numSV;		// Number of satellites in view
+	uint8_t count;		// Satellites in this sentence
+	std::array<Satellite, perSentence> sv;
+	uint8_t signalId;	// NMEA Signal ID. 0 if not given (NMEA 4.0 and earlier).
+
+	GSV(const Sentence & fields);
+	GSV(const string & nmea);
+	virtual ~GSV() = default;
+
+	virtual string toString(char *) final{return "";}	// Unimplemented
+};
+
 class NMEA_Standard::ZDA : public NMEA_Standard{
 public:
 	struct UTC_DateTime : UTC_Time{
@@ -256,8 +426,9 @@ public:
 			uint8_t day, uint8_t month, uint16_t year, 
 			uint8_t ltzh, uint8_t ltzm);
 		
-		time_t epoch() const;
-		time_t midnight() const;
+		time_t epoch() const;		// UNIX Epoch Time [s]
+		int64_t epochMs() const;	// UNIX Epoch Time [ms]
+		time_t midnight() const;	// UNIX Epoch Time of 00:00:00 [s]
 
 		operator time_t() const;	// UNIX Epoch Time
 	};
@@ -265,13 +436,50 @@ public:
 	Address addr;
 	UTC_DateTime time;
 
-	ZDA(const std::array<StaticString, 9> & fields);
+	ZDA(const Sentence & fields);
 	ZDA(const string & nmea);
 	virtual ~ZDA() = default;
 
 	virtual string toString(char *) final{return "";}	// Unimplemented
 };
 
+class NMEA_Standard::RMC : public NMEA_Standard{
+public:
+	Address addr;
+	ZDA::UTC_DateTime time;	// Time and Date. No local zone.
+	char status;		// 'A' Valid, 'V' Invalid
+	Coordinate lat;
+	Coordinate lon;
+	int32_t spd;		// Speed over Ground [knots x 1e3]
+	int32_t cog;		// Course over Ground, True [deg x 1e5]
+	int32_t mv;			// Magnetic Variation [deg x 1e5]
+	char mvEW;
+	char posMode;		// Mode Indicator
+	char navStatus;		// Navigational Status (NMEA 4.10 and later)
+
+	RMC(const Sentence & fields);
+	RMC(const string & nmea);
+	virtual ~RMC() = default;
+
+	virtual string toString(char *) final{return "";}	// Unimplemented
+};
+
+class NMEA_Standard::VTG : public NMEA_Standard{
+public:
+	Address addr;
+	int32_t cogt;		// Course over Ground, True [deg x 1e5]
+	int32_t cogm;		// Course over Ground, Magnetic [deg x 1e5]
+	int32_t sogn;		// Speed over Ground [knots x 1e3]
+	int32_t sogk;		// Speed over Ground [m/h]
+	char posMode;		// Mode Indicator
+
+	VTG(const Sentence & fields);
+	VTG(const string & nmea);
+	virtual ~VTG() = default;
+
+	virtual string toString(char *) final{return "";}	// Unimplemented
+};
+
 class NMEA_Standard::BAD : public NMEA_Standard{
 public:
 	string nmea;
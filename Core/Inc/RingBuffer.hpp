@@ -0,0 +1,262 @@
+/**
+  ******************************************************************************
+  * @file			: RingBuffer.hpp
+  * @brief			: Lock-Free Single-Producer Single-Consumer Byte Ring
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Concurrency Model:
+ * Exactly one producer (typically an ISR) may call write() and free().
+ * Exactly one consumer (typically the main loop) may call view(), peek(), consume(), read() and available().
+ * Each index is only ever stored by its owning side. The owning side publishes with release ordering after the data
+ * is in place, and the other side loads with acquire ordering before touching the data. On Cortex-M this compiles to
+ * plain halfword loads and stores separated by DMB instructions, so neither side ever needs to disable interrupts.
+ *
+ * An external producer (e.g. a DMA controller writing into storage()) cannot be throttled and may lap the consumer.
+ * commit() detects each such lap. The consumer must call resync() after taking each view(), and discard the view if a
+ * lap occurred.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <atomic>
+
+#include "StaticString.hpp"
+
+/**
+ * @brief Read-only view over data held in a circular buffer.
+ * 
+ * Data which wraps around the end of the storage is described as two contiguous segments, so that it can be scanned
+ * in place. Only a consumer which needs a contiguous copy (see linear()) ever copies the data.
+ */
+class SegmentedView{
+private:
+	const uint8_t * s0;	// First segment, starting at the read index.
+	uint16_t l0;
+	const uint8_t * s1;	// Second segment, starting at the beginning of storage. Empty if the data does not wrap.
+	uint16_t l1;
+
+public:
+	SegmentedView() : s0(nullptr), l0(0u), s1(nullptr), l1(0u) {}
+	SegmentedView(const uint8_t * s0, uint16_t l0, const uint8_t * s1, uint16_t l1) : s0(s0), l0(l0), s1(s1), l1(l1) {}
+
+	inline uint16_t size() const { return l0 + l1; }
+	inline bool empty() const { return size() == 0; }
+	inline bool contiguous() const { return l1 == 0; }
+	inline uint8_t operator [](uint16_t i) const { return (i < l0) ? s0[i] : s1[i - l0]; }
+
+	/**
+	 * @brief The contiguous run of characters starting at index i.
+	 * 
+	 * @param p	Set to the address of character i.
+	 * @return uint16_t The length of the run, up to the end of the segment containing i.
+	 */
+	inline uint16_t run(uint16_t i, const uint8_t *& p) const {
+		if(i < l0){ p = s0 + i; return l0 - i; }
+		p = s1 + (i - l0);
+		return size() - i;
+	}
+
+	SegmentedView sub(uint16_t begin, uint16_t len) const {
+		if(begin >= l0) return SegmentedView(s1 + (begin - l0), len, nullptr, 0u);
+		else if(begin + len <= l0) return SegmentedView(s0 + begin, len, nullptr, 0u);
+		else return SegmentedView(s0 + begin, l0 - begin, s1, len - (l0 - begin));
+	}
+
+	/**
+	 * @brief Contiguous representation of the view.
+	 * 
+	 * @param scratch	Buffer used only if the view wraps.
+	 * @param n			Size of scratch.
+	 * @return StaticString Pointing into the original storage where possible. Empty if the view wraps and does not fit in scratch.
+	 */
+	StaticString linear(uint8_t * scratch, uint16_t n) const {
+		if(contiguous()) return StaticString(s0, s0 + l0);
+		else if(size() > n) return StaticString();
+		memcpy(scratch, s0, l0);
+		memcpy(scratch + l0, s1, l1);
+		return StaticString(scratch, scratch + size());
+	}
+};
+
+template<size_t S, typename tS = uint16_t>
+class RingBuffer{
+	static_assert(S > 1, "Ring size must allow at least one byte of storage.");
+	static_assert(S - 1 <= static_cast<tS>(-1), "Index type too small for ring size.");
+	static_assert(std::atomic<tS>::is_always_lock_free, "Ring indices must be lock-free on this platform.");
+
+	uint8_t buff[S];				// Static Storage. One slot is always kept empty to distinguish full from empty.
+	std::atomic<tS> head{0};		// Next index to be written. Only stored by the producer.
+	std::atomic<tS> tail{0};		// Next index to be read. Only stored by the consumer.
+	std::atomic<tS> dropped{0};		// Count of bytes discarded by the producer because the ring was full, or overwritten.
+	std::atomic<tS> laps{0};		// Count of commits which overwrote unread data. Only stored by the producer.
+	std::atomic<tS> lapsSeen{0};	// laps at the last resync(). Only stored by the consumer.
+
+	static constexpr tS wrap(size_t i) { return static_cast<tS>( (i >= S) ? i - S : i ); }
+
+public:
+	static constexpr tS capacity = S - 1;
+
+	/* Producer Interface */
+
+	tS free() const {
+		const tS h = head.load(std::memory_order_relaxed);
+		const tS t = tail.load(std::memory_order_acquire);
+		return (t > h) ? (t - h - 1) : (capacity - (h - t));
+	}
+
+	/**
+	 * @brief Append up to n bytes to the ring.
+	 *
+	 * @param src	Source data.
+	 * @param n		Number of bytes requested to be written.
+	 * @return tS	Number of bytes actually written. Bytes which do not fit are counted as dropped.
+	 */
+	tS write(const uint8_t * src, tS n){
+		const tS f = free();
+		if(n > f){
+			dropped.store(dropped.load(std::memory_order_relaxed) + (n - f), std::memory_order_relaxed);
+			n = f;
+		}
+
+		const tS h = head.load(std::memory_order_relaxed);
+		const tS first = (n < S - h) ? n : static_cast<tS>(S - h);	// Portion before the end of storage.
+		memcpy(buff + h, src, first);
+		memcpy(buff, src + first, n - first);
+
+		head.store(wrap(h + n), std::memory_order_release);	// Publish only after the data is in place.
+		return n;
+	}
+
+	/**
+	 * @brief Publish data that was written directly into storage() by an external producer (e.g. a DMA controller).
+	 * 
+	 * @param h The new head index. Data in [writeIndex(), h) must already be in place.
+	 * @return tS Number of bytes which the consumer will discard through resync(), counted as dropped: upon a lap,
+	 * 		   all unread data and the data written, and then all data written until the consumer has resynced.
+	 * 
+	 * @note The external producer cannot be throttled. An advance of a whole lap or more cannot be told from no
+	 * 		 advance at all, so the producer must commit at least once per S - 1 bytes (e.g. upon every half transfer).
+	 * @note A commit racing with resync() may be counted although the consumer goes on to read it.
+	 */
+	tS commit(tS h){
+		h = wrap(h);
+		const tS old = head.load(std::memory_order_relaxed);
+		const tS n = (h >= old) ? (h - old) : static_cast<tS>(S - (old - h));	// Bytes written.
+		const tS l = laps.load(std::memory_order_relaxed);
+
+		tS lost = 0;
+		if(l != lapsSeen.load(std::memory_order_acquire)) lost = n;	// Still lapped. The indices are meaningless.
+		else{
+			const tS f = free();
+			if(n > f){
+				lost = (capacity - f) + n;
+				laps.store(l + 1, std::memory_order_release);	// Before the head, so that a consumer seeing h sees the lap.
+			}
+		}
+		if(lost != 0) dropped.store(dropped.load(std::memory_order_relaxed) + lost, std::memory_order_relaxed);
+		head.store(h, std::memory_order_release);
+		return lost;
+	}
+
+	uint8_t * storage() { return buff; }
+	static constexpr size_t size = S;
+
+	/* Consumer Interface */
+
+	tS available() const {
+		const tS h = head.load(std::memory_order_acquire);
+		const tS t = tail.load(std::memory_order_relaxed);
+		return (h >= t) ? (h - t) : static_cast<tS>(S - (t - h));
+	}
+
+	/**
+	 * @brief Copy up to n bytes from the front of the ring without consuming them.
+	 *
+	 * @return tS Number of bytes copied.
+	 */
+	tS peek(uint8_t * dst, tS n) const {
+		const tS a = available();
+		if(n > a) n = a;
+
+		const tS t = tail.load(std::memory_order_relaxed);
+		const tS first = (n < S - t) ? n : static_cast<tS>(S - t);
+		memcpy(dst, buff + t, first);
+		memcpy(dst + first, buff, n - first);
+		return n;
+	}
+
+	/**
+	 * @brief Zero-copy view of all unread data.
+	 */
+	SegmentedView view() const {
+		const tS a = available();
+		const tS t = tail.load(std::memory_order_relaxed);
+		const tS first = (a < S - t) ? a : static_cast<tS>(S - t);
+		return SegmentedView(buff + t, first, buff, a - first);
+	}
+
+	/**
+	 * @brief Release n bytes from the front of the ring back to the producer.
+	 */
+	void consume(tS n){
+		const tS a = available();
+		if(n > a) n = a;
+		tail.store(wrap(tail.load(std::memory_order_relaxed) + n), std::memory_order_release);
+	}
+
+	tS read(uint8_t * dst, tS n){
+		n = peek(dst, n);
+		consume(n);
+		return n;
+	}
+
+	/**
+	 * @brief Discards all unread data if the producer has overwritten any of it since the last call.
+	 * 
+	 * @return true if data was discarded. A view() taken before the call must then be discarded too, as its order
+	 * 		   and content are no longer those received.
+	 * 
+	 * @note A view() taken before a false return is intact up to the commit it saw, as the lap count is stored before
+	 * 		 the head index. Data overwritten after that commit is only detected on the producer's next commit.
+	 */
+	bool resync(){
+		const tS l = laps.load(std::memory_order_acquire);
+		if(l == lapsSeen.load(std::memory_order_relaxed)) return false;
+		tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+		lapsSeen.store(l, std::memory_order_release);	// After the tail, so that the producer sees a consistent ring.
+		return true;
+	}
+
+	/**
+	 * @brief Empties the ring, returning both indices to the beginning of storage, as an external producer restarts.
+	 * 
+	 * @note Only while the producer is stopped, so that neither index is stored concurrently.
+	 */
+	void reset(){
+		tail.store(0, std::memory_order_relaxed);
+		head.store(0, std::memory_order_relaxed);
+		lapsSeen.store(laps.load(std::memory_order_relaxed), std::memory_order_release);
+	}
+
+	/* Diagnostics. May be read from either side. */
+	tS overruns() const { return dropped.load(std::memory_order_relaxed); }
+	tS writeIndex() const { return head.load(std::memory_order_relaxed); }
+};
+
+/*** END OF FILE ***/
@@ -0,0 +1,80 @@
+/**
+  ******************************************************************************
+  * @file			: SatelliteTable.hpp
+  * @brief			: Satellites in View, Assembled from GSV Groups
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage:
+ * Each GSV sentence is passed to receive(). The sentences of a group (one talker and signal) are assembled in a back
+ * table, which replaces that talker and signal's rows of the current table. When the last sentence of the group is
+ * received the back table becomes current in a single write, so current() only ever holds complete groups. A group
+ * received out of sequence is discarded and the current table is left unchanged. A PUBX,03 sentence lists every
+ * satellite at once and replaces the whole table.
+ *
+ * The table is held as parallel arrays (structure of arrays), one row per satellite signal, so that counts and C/N0
+ * statistics are simple loops over a single array.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <array>
+
+#include "M9N_Base.hpp"
+#include "NMEA_Standard.hpp"
+
+class SatelliteTable{
+public:
+	static const uint8_t capacity = 64u;	// Rows across all talkers and signals. Further rows are dropped.
+
+	struct Table{
+		uint8_t count = 0u;									// Rows in use.
+		std::array<NMEA_Standard::TalkerID, capacity> talker;
+		std::array<uint8_t, capacity> svid;					// Satellite ID
+		std::array<uint8_t, capacity> elevation;			// [deg]. 0 if unknown.
+		std::array<uint16_t, capacity> azimuth;				// [deg]. 0 if unknown.
+		std::array<uint8_t, capacity> cno;					// C/N0 [dBHz]. 0 if not tracked.
+		std::array<uint8_t, capacity> signalId;				// NMEA Signal ID. 0 if not given.
+	};
+
+	struct Summary{
+		uint8_t inView;		// Rows in the table.
+		uint8_t tracked;	// Rows with a C/N0.
+		uint8_t maxCno;		// [dBHz]
+		uint8_t meanCno;	// Of the tracked rows [dBHz].
+	};
+
+	bool receive(const NMEA_Standard::GSV & gsv);	// True if a group was completed and the table replaced.
+	bool receive(const M9N_Base::NMEA_PUBX::SvStatus & status);	// Replaces the whole table. Talker GN, signal 0.
+	void clear();
+
+	inline const Table & current() const { return tables[front]; }
+	Summary summary() const;
+
+private:
+	Table tables[2];
+	volatile uint8_t front = 0u;	// Index of current(). The other table is the back table.
+
+	/* Group being assembled in the back table */
+	NMEA_Standard::TalkerID talker = NMEA_Standard::TalkerID::UNKNOWN;
+	uint8_t signalId = 0u;
+	uint8_t numMsg = 0u;
+	uint8_t next = 0u;		// msgNum expected next. 0 if no group is being assembled.
+
+	void begin(const NMEA_Standard::GSV & gsv);
+};
+
+/*** END OF FILE ***/
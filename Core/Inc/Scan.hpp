@@ -0,0 +1,275 @@
+/**
+  ******************************************************************************
+  * @file			: Scan.hpp
+  * @brief			: Block-at-a-time Character Scanning Kernels
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Kernel Selection:
+ * SCAN_KERNEL selects how many characters are examined at once. By default the widest kernel supported by the target
+ * is used:
+ * 	SCAN_AVX2	32 characters per block, where the compiler targets AVX2 (e.g. a host build with -mavx2).
+ * 	SCAN_SSE2	16 characters per block. Always available on x86-64.
+ * 	SCAN_SWAR	4 characters per 32-bit word, on any little-endian target (e.g. Cortex-M4).
+ * 	SCAN_SCALAR	1 character at a time.
+ * Every kernel gives identical results. Blocks are only ever loaded in full from within the given range.
+ *
+ * Each kernel is a set of block primitives, from which BasicScan builds the scans. Scan is BasicScan of the selected
+ * kernel. Every kernel the target supports is defined, so that they can be compared against one another.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define SCAN_SCALAR	0
+#define SCAN_SWAR	1
+#define SCAN_SSE2	2
+#define SCAN_AVX2	3
+
+#ifndef SCAN_KERNEL
+	#if defined(__AVX2__)
+		#define SCAN_KERNEL SCAN_AVX2
+	#elif defined(__SSE2__)
+		#define SCAN_KERNEL SCAN_SSE2
+	#elif defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+		#define SCAN_KERNEL SCAN_SWAR
+	#else
+		#define SCAN_KERNEL SCAN_SCALAR
+	#endif
+#endif
+
+#if defined(__AVX2__)
+	#include <immintrin.h>
+#elif defined(__SSE2__)
+	#include <emmintrin.h>
+#endif
+
+
+using ScanMask = uint32_t;	// Bit i set for character i of a block.
+
+/* Kernel Primitives */
+// load		Block starting at p.
+// eq		Mask of the characters equal to c.
+// special	Mask of the characters outside printable ASCII (0x20 to 0x7E).
+// bxor		Characters XORed lane-wise. fold() reduces the lanes to a single character.
+
+#if defined(__AVX2__)
+struct Avx2Kernel{
+	using Word = __m256i;
+	static const size_t width = 32u;
+
+	static inline Word load(const uint8_t * p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+	static inline Word zero() { return _mm256_setzero_si256(); }
+	static inline Word bxor(Word a, Word b) { return _mm256_xor_si256(a, b); }
+	static inline ScanMask eq(Word w, uint8_t c) {
+		return static_cast<ScanMask>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(w, _mm256_set1_epi8(static_cast<char>(c)))));
+	}
+	static inline ScanMask special(Word w) {
+		// Signed comparison: characters of 0x80 and above are negative, so also less than 0x20.
+		return static_cast<ScanMask>(_mm256_movemask_epi8(_mm256_or_si256(
+			_mm256_cmpgt_epi8(_mm256_set1_epi8(0x20), w), _mm256_cmpeq_epi8(w, _mm256_set1_epi8(0x7F)) )));
+	}
+	static inline uint8_t fold(Word w) {
+		__m128i x = _mm_xor_si128(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+		x = _mm_xor_si128(x, _mm_srli_si128(x, 8));
+		x = _mm_xor_si128(x, _mm_srli_si128(x, 4));
+		x = _mm_xor_si128(x, _mm_srli_si128(x, 2));
+		x = _mm_xor_si128(x, _mm_srli_si128(x, 1));
+		return static_cast<uint8_t>(_mm_cvtsi128_si32(x));
+	}
+};
+#endif
+
+#if defined(__SSE2__)
+struct Sse2Kernel{
+	using Word = __m128i;
+	static const size_t width = 16u;
+
+	static inline Word load(const uint8_t * p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+	static inline Word zero() { return _mm_setzero_si128(); }
+	static inline Word bxor(Word a, Word b) { return _mm_xor_si128(a, b); }
+	static inline ScanMask eq(Word w, uint8_t c) {
+		return static_cast<ScanMask>(_mm_movemask_epi8(_mm_cmpeq_epi8(w, _mm_set1_epi8(static_cast<char>(c)))));
+	}
+	static inline ScanMask special(Word w) {
+		// Signed comparison: characters of 0x80 and above are negative, so also less than 0x20.
+		return static_cast<ScanMask>(_mm_movemask_epi8(_mm_or_si128(
+			_mm_cmplt_epi8(w, _mm_set1_epi8(0x20)), _mm_cmpeq_epi8(w, _mm_set1_epi8(0x7F)) )));
+	}
+	static inline uint8_t fold(Word x) {
+		x = _mm_xor_si128(x, _mm_srli_si128(x, 8));
+		x = _mm_xor_si128(x, _mm_srli_si128(x, 4));
+		x = _mm_xor_si128(x, _mm_srli_si128(x, 2));
+		x = _mm_xor_si128(x, _mm_srli_si128(x, 1));
+		return static_cast<uint8_t>(_mm_cvtsi128_si32(x));
+	}
+};
+#endif
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+struct SwarKernel{
+	using Word = uint32_t;
+	static const size_t width = sizeof(Word);
+	static const Word ones = 0x01010101u;
+	static const Word highs = 0x80808080u;
+
+	static inline Word load(const uint8_t * p) { Word w; memcpy(&w, p, sizeof(w)); return w; }	// Unaligned LDR on Cortex-M4.
+	static inline Word zero() { return 0u; }
+	static inline Word bxor(Word a, Word b) { return a ^ b; }
+
+	// Per-character high bits to a bit per character. Exact: the additions below never carry between characters.
+	static inline ScanMask compress(Word h) { return (((h >> 7) * 0x00204081u) >> 21) & 0xFu; }
+	static inline Word zeros(Word v) { return ~(((v & ~highs) + ~highs) | v) & highs; }
+	static inline ScanMask eq(Word w, uint8_t c) { return compress(zeros(w ^ (ones * c))); }
+	static inline ScanMask special(Word w) {
+		const Word below = ~(((w & ~highs) + ones * (0x80u - 0x20u)) | w) & highs;	// Less than 0x20.
+		return compress(below | (w & highs) | zeros(w ^ (ones * 0x7Fu)));
+	}
+	static inline uint8_t fold(Word w) { w ^= w >> 16; w ^= w >> 8; return static_cast<uint8_t>(w); }
+};
+#endif
+
+struct ScalarKernel{
+	using Word = uint8_t;
+	static const size_t width = 1u;
+
+	static inline Word load(const uint8_t * p) { return *p; }
+	static inline Word zero() { return 0u; }
+	static inline Word bxor(Word a, Word b) { return a ^ b; }
+	static inline ScanMask eq(Word w, uint8_t c) { return w == c; }
+	static inline ScanMask special(Word w) { return (w < 0x20u) || (w > 0x7Eu); }
+	static inline uint8_t fold(Word w) { return w; }
+};
+
+template<typename K>
+class BasicScan{
+public:
+	using Mask = ScanMask;
+
+	/**
+	 * @brief Index of the first occurrence of a or b.
+	 *
+	 * @return size_t n if neither occurs.
+	 */
+	static inline size_t find(const uint8_t * p, size_t n, uint8_t a, uint8_t b){
+		size_t i = 0;
+		for(; i + width <= n; i += width){
+			const Word w = K::load(p + i);
+			const Mask m = K::eq(w, a) | K::eq(w, b);
+			if(m != 0u) return i + ctz(m);
+		}
+		for(; i < n; i++) if( (p[i] == a) || (p[i] == b) ) return i;
+		return n;
+	}
+
+	/**
+	 * @brief Length of the leading run of printable characters other than a and b, XORing the run into chk.
+	 */
+	static inline size_t printable(const uint8_t * p, size_t n, uint8_t a, uint8_t b, uint8_t & chk){
+		Word acc = K::zero();
+		size_t i = 0;
+		for(; i + width <= n; i += width){
+			const Word w = K::load(p + i);
+			const Mask m = K::eq(w, a) | K::eq(w, b) | K::special(w);
+			if(m != 0u){
+				const unsigned k = ctz(m);
+				chk ^= K::fold(acc) ^ reduce(p + i, k);
+				return i + k;
+			}
+			acc = K::bxor(acc, w);
+		}
+
+		uint8_t x = chk ^ K::fold(acc);
+		for(; i < n; i++){
+			const uint8_t c = p[i];
+			if( (c == a) || (c == b) || (c < 0x20u) || (c > 0x7Eu) ) break;
+			x ^= c;
+		}
+		chk = x;
+		return i;
+	}
+
+	/**
+	 * @brief Reports each delim before the first end and XORs every character before the first end, in a single pass.
+	 *
+	 * @param onDelim	Called with the index of each delim in order of occurrence.
+	 * @param chk		Set to the XOR of all characters before the first end.
+	 * @return size_t	The index of the first end, or n if it does not occur.
+	 */
+	template<typename F>
+	static inline size_t split(const uint8_t * p, size_t n, uint8_t delim, uint8_t end, uint8_t & chk, F onDelim){
+		Word acc = K::zero();
+		size_t i = 0;
+		for(; i + width <= n; i += width){
+			const Word w = K::load(p + i);
+			const Mask e = K::eq(w, end);
+			Mask d = K::eq(w, delim);
+			if(e != 0u){
+				const unsigned k = ctz(e);
+				for(d &= (1u << k) - 1u; d != 0u; d &= d - 1u) onDelim(i + ctz(d));
+				chk = K::fold(acc) ^ reduce(p + i, k);
+				return i + k;
+			}
+			for(; d != 0u; d &= d - 1u) onDelim(i + ctz(d));
+			acc = K::bxor(acc, w);
+		}
+
+		uint8_t x = K::fold(acc);
+		for(; i < n; i++){
+			if(p[i] == end) break;
+			if(p[i] == delim) onDelim(i);
+			x ^= p[i];
+		}
+		chk = x;
+		return i;
+	}
+
+	/**
+	 * @brief XOR of n characters.
+	 */
+	static inline uint8_t checksum(const uint8_t * p, size_t n){
+		Word acc = K::zero();
+		size_t i = 0;
+		for(; i + width <= n; i += width) acc = K::bxor(acc, K::load(p + i));
+		return K::fold(acc) ^ reduce(p + i, n - i);
+	}
+
+private:
+	using Word = typename K::Word;
+	static const size_t width = K::width;
+
+	static inline unsigned ctz(Mask m) { return __builtin_ctz(m); }
+
+	static inline uint8_t reduce(const uint8_t * p, size_t n){
+		uint8_t x = 0u;
+		for(size_t i = 0; i < n; i++) x ^= p[i];
+		return x;
+	}
+};
+
+#if SCAN_KERNEL == SCAN_AVX2
+using Scan = BasicScan<Avx2Kernel>;
+#elif SCAN_KERNEL == SCAN_SSE2
+using Scan = BasicScan<Sse2Kernel>;
+#elif SCAN_KERNEL == SCAN_SWAR
+using Scan = BasicScan<SwarKernel>;
+#else
+using Scan = BasicScan<ScalarKernel>;
+#endif
+
+/*** END OF FILE ***/
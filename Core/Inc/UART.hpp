@@ -30,10 +30,44 @@
 #include <deque>
 
 #include "stm32l4xx_hal.h"
+#include "RingBuffer.hpp"
 #include "StaticString.hpp"
 
 using string = StaticString;
 
+/**
+ * Rx Zero-Copy Mode:
+ * When UART_RX_ZERO_COPY is defined non-zero, the DMA circular buffer is itself the Rx ring. The Rx event callback only
+ * publishes the new DMA position and consumers scan the received bytes in place. This removes the ISR copy into the
+ * offload buffer and that buffer's RAM. The DMA controller cannot be held off, so if the consumer falls a whole buffer
+ * behind the unread data is overwritten. Each such lap is detected from the DMA position reported at the half,
+ * complete and idle events, counted in overruns(), and reported by resync() so that the consumer can discard the
+ * unread data and resume framing. The DMA buffer is enlarged accordingly.
+ */
+#ifndef UART_RX_ZERO_COPY
+#define UART_RX_ZERO_COPY 0
+#endif
+
+/**
+ * Non-blocking Transmission:
+ * tryAlloc() and submit() never wait. When the Tx buffer has no room they return nullptr or wouldBlock and the caller
+ * retries later, e.g. on its next pass of the main loop, so that large uploads overlap with reception and parsing.
+ * A submitted message is identified by its Token: sent() may be polled, or a Notify given to submit() is called from
+ * the Tx complete interrupt once the message has left the UART. Notifications must therefore be brief and must not
+ * transmit. alloc() and the transmit() overloads keep their blocking behaviour.
+ *
+ * Transmissions are queued as descriptors, each referring either to an allocation in the Tx buffer or, through
+ * submitInPlace(), to immutable data held by the caller: a constant in flash, a frame encoded at compile time or an
+ * MGA assistance database. Such data is transmitted directly by the DMA controller without being copied and is not
+ * limited by the size of the Tx buffer, but must remain unchanged until sent. Descriptors are chained from the Tx
+ * complete interrupt, with those which continue on in memory joined into a single DMA transfer.
+ *
+ * Descriptors are queued in one of two lanes. At each transfer boundary the COMMAND lane is served first, and the
+ * BULK lane only while no command is waiting. Bulk transfers are limited to bulkSlice characters, so a command waits
+ * at most one slice behind an upload (22 ms at 115200 Bd). Data copied into the Tx buffer always takes the COMMAND
+ * lane, as the buffer is released in order. statistics() reports the queueing delay of each lane.
+ */
+
 class UART{
 private:
 	UART_HandleTypeDef * hUart;	// STM32 HAL UART Handle
@@ -46,28 +80,105 @@ private:
 
 public:
 	class Tx{
+	public:
+		typedef uint32_t Token;		// Lane in bit 31. Count of characters submitted to the lane up to the end of a message in bits 0-30.
+		typedef void (*Notify)(Token t, void * ctx);	// Called from the Tx complete interrupt once a message is sent.
+		static const Token wouldBlock = 0u;				// Returned when a submission would have to wait for space.
+
+		enum class Lane : uint8_t{
+			COMMAND,	// Commands and all data copied into the Tx buffer. Always served first.
+			BULK		// Large uploads held in place, such as MGA assistance. Served in slices between commands.
+		};
+		static const uint8_t lanes = 2u;
+
+		struct Statistics{		// Queueing delay of a lane, from submission until transmission begins.
+			uint32_t messages;		// Descriptors whose transmission has begun.
+			uint32_t totalDelay;	// Sum of their delays [ms].
+			uint32_t maxDelay;		// Longest delay [ms].
+		};
+
+	private:
 		UART_HandleTypeDef * hUart;
 
 		static const uint16_t buffSize = 512u;
 		std::array<uint8_t, buffSize>buff;
 				 uint8_t * alHead = buff.data();	// Head Buffer Allocation
-				 uint8_t * scHead = buff.data();	// Head Scheduled Transmission
-				 uint8_t * lpHead = buff.data();	// Head Maximum Allocated before Buffer Looping Occurred
-		volatile uint8_t * txHead = buff.data();	// Head Active Transmission
-		volatile uint8_t * tail;
+				 uint8_t * alLast = buff.data();	// Latest Allocation
+		volatile uint8_t * tail = buff.data();		// End of Transmitted Buffer Data. Data from here is still in use.
+
+		struct Descriptor{	// A contiguous segment of data to be transmitted.
+			const uint8_t * data;
+			uint16_t size;
+			bool ring;		// Data is in buff and is released once transmitted. Else it is owned by the caller.
+			uint32_t queued;	// Tick of submission.
+		};
+		struct Notification{
+			Token token;
+			Notify done;
+			void * ctx;
+		};
+
+		static const uint8_t queueCapacity = 16u;	// Descriptors queued at once per lane. Power of 2.
+		static_assert((queueCapacity & (queueCapacity - 1u)) == 0u, "Queue capacity must be a power of 2.");
+		static const uint8_t notifyCapacity = 8u;	// Notifications pending at once per lane. Power of 2.
+		static_assert((notifyCapacity & (notifyCapacity - 1u)) == 0u, "Notification capacity must be a power of 2.");
+		static const uint16_t maxTransfer = UINT16_MAX;	// Largest single DMA transfer.
+		static const uint16_t bulkSlice = 256u;			// Largest transfer from the bulk lane, bounding the wait of a command.
+
+		struct Queue{	// Descriptors and notifications of one lane, each served in order.
+			std::array<Descriptor, queueCapacity> desc{};
+			volatile uint8_t head = 0u;		// Descriptors queued. Advanced by submissions.
+			volatile uint8_t tail = 0u;		// Descriptors transmitted. Advanced by nextTransmission().
+			uint16_t offset = 0u;			// Characters of the tail descriptor already transmitted.
+
+			std::array<Notification, notifyCapacity> notifications{};
+			volatile uint8_t ntHead = 0u;	// Notifications queued. Advanced by submissions.
+			volatile uint8_t ntTail = 0u;	// Notifications delivered. Advanced in the ISR.
+
+					 Token scCount = 0u;	// Characters submitted.
+			volatile Token txCount = 0u;	// Characters whose transmission has completed.
+
+			Statistics stats{};
+
+			inline uint8_t free() const { return queueCapacity - static_cast<uint8_t>(head - tail); }
+			inline bool notifyFull() const { return static_cast<uint8_t>(ntHead - ntTail) >= notifyCapacity; }
+			inline bool scheduled() const { return head != tail; }
+		};
+		std::array<Queue, lanes> queues{};
+		Lane txLane = Lane::COMMAND;		// Lane of the active transmission.
+		volatile uint16_t txLen = 0u;		// Characters in the active transmission.
 
 		static const uint16_t delayTime = 50;	// Unit period where alloc will wait for transmission to.
 		static const uint16_t timeout = 10*delayTime;	// Timeout on waiting for memory to free.
 
+		inline Queue & queue(Lane l) { return queues[static_cast<uint8_t>(l)]; }
+		static inline Token token(Lane l, Token count) { return (static_cast<Token>(l) << 31) | (count & 0x7FFFFFFFu); }
+		void enqueue(Lane l, const uint8_t * data, uint16_t n, bool ring);
+		void track(Lane l, Token t, Notify done, void * ctx);
+		void complete(Queue & q, uint16_t n);
+		void begin(Lane l);
+		void notify();			// Delivers the notifications of every message sent.
 		void txCmpltCallback();	// Must be called upon UART transmission complete.
 		friend void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
-		friend void errorCallback(UART_HandleTypeDef * huart);
+		friend void UART::errorCallback(UART_HandleTypeDef * huart);
 
 	public:
+		static const uint16_t capacity = buffSize - 1u;	// Largest single allocation. alloc() refuses a whole buffer.
+
 		Tx(UART_HandleTypeDef * hUart) : hUart(hUart) {}
 
-		uint8_t * alloc(uint16_t size) noexcept;	// Allocate memory in the buffer.
-		void transmit(uint16_t n);					// Transmit n characters that have been allocated and set.
+		uint8_t * alloc(uint16_t size) noexcept;	// Allocate memory in the buffer. Waits up to timeout for space.
+		uint8_t * tryAlloc(uint16_t size) noexcept;	// Allocate memory in the buffer. nullptr if it would have to wait.
+		void transmit(uint16_t n);					// Transmit the first n characters of the latest allocation.
+
+		/* Non-blocking Interface */
+		Token submit(uint16_t n, Notify done = nullptr, void * ctx = nullptr);	// As transmit(n), also tracking the message.
+		Token submit(const uint8_t * first, const uint8_t * last, Notify done = nullptr, void * ctx = nullptr);	// Copies.
+		Token submitInPlace(const uint8_t * first, const uint8_t * last, Notify done = nullptr, void * ctx = nullptr,
+			Lane lane = Lane::COMMAND);
+		bool sent(Token t) const;
+
+		bool transmitInPlace(const uint8_t * first, const uint8_t * last, Lane lane = Lane::COMMAND);	// Waits up to timeout to be queued.
 
 		void transmit(const StaticString & msg);
 		template<typename T>
@@ -76,7 +187,10 @@ public:
 		void nextTransmission();
 
 		bool txBusy() const;	// Checks for a current UART Transmission Process.
-		bool txScheduled() const;
+		bool txScheduled() const;	// Checks for data queued which has not been completely transmitted.
+		inline bool drained() const { return !txScheduled() && !txBusy(); }
+
+		inline const Statistics & statistics(Lane l) const { return queues[static_cast<uint8_t>(l)].stats; }
 
 	} tx;
 
@@ -96,15 +210,23 @@ public:
 		};
 
 		static const size_t buffSize = 254u;
-		Buffer<buffSize> dmaBuff{};			// Main Circular Buffer given to HAL DMA Process
-		Buffer<8*buffSize> offloadBuff{};	// Large static offloading buffer. Rx Event Callbacks will move data from rxBuff to here.
+#if UART_RX_ZERO_COPY
+		RingBuffer<8*buffSize> dmaRing{};		// Circular Buffer given to HAL DMA Process. Consumed in place.
+		uint16_t dmaHead = 0;					// Last DMA position reported to rxEventCallback.
+#else
+		Buffer<buffSize> dmaBuff{};				// Main Circular Buffer given to HAL DMA Process
+		RingBuffer<8*buffSize> offloadBuff{};	// Lock-free offloading ring. Rx Event Callbacks produce into it, M9N::scanMessages consumes from it.
+#endif
+		uint16_t lastHead = 0;					// Ring head at the last dataReady() call.
 		bool receiving = false;	// Notes if currently in receiving mode. Will be used to re-enable if there is and error requiring peripheral reset.
 
 		friend class M9N;	// Temporary for testing
 		
+		void restart();		// Resumes reception after the peripheral was re-initialised. Discards unread data in zero-copy mode.
 		void rxEventCallback(uint16_t size);	// Must be called upon UART idle, half and full complete data reception.
 		friend void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
 		friend void UART::errorCallback(UART_HandleTypeDef * huart);
+		friend class UART;		// setBaudrate() resumes reception.
 	
 	public:
 		Rx(UART_HandleTypeDef * hUart) : hUart(hUart){}
@@ -112,11 +234,18 @@ public:
 		void beginReceive();	// Begins data reception. Does not initialise the STM32 UART peripheral device.
 		void endReceive();		// Ends data reception. Does not de-initialise the STM32 UART peripheral device.
 		bool dataReady();
+
+		/* Consumer Interface. Only to be used from a single (non-ISR) context. */
+		SegmentedView peek() const;		// View of all unread data, in place.
+		void consume(uint16_t n);		// Release n characters from the front of the unread data.
+		uint16_t capacity() const;		// Maximum amount of unread data that can be held.
+		bool resync();					// True if unread data was overwritten, and has now all been discarded.
+		uint16_t overruns() const;		// Characters lost to a full offload ring or to the DMA lapping the consumer.
 	} rx;
 	
 	UART(UART_HandleTypeDef * h, IRQn_Type uartIrq, IRQn_Type dmaTxIrq, IRQn_Type dmaRxIrq);
 
-	void setBaudrate(uint32_t baud) const;
+	void setBaudrate(uint32_t baud);	// Any transmission in progress is aborted. Reception is resumed.
 
 	void interruptsOff() const;	// Disables all UART related interrupts.
 	void interruptsOn() const;	// Enables all UART related interrupts.
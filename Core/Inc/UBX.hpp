@@ -21,11 +21,15 @@
 /* Begin Public Includes */
 
 #include "stdio.h"
+#include <string.h>
 
 #include <array>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "StaticString.hpp"
+
 using vect = std::vector<uint8_t>;
 
 class UBX{
@@ -45,6 +49,15 @@ public:
 
 	class BAD;	//	NOT a real UBX object. Returned by factory when an invalid UBX is passed.
 
+	template<typename T, size_t Offset>
+	struct Field;	// Payload schema entry.
+
+	template<typename T, size_t Offset, size_t N>
+	struct Array;	// Payload schema entry of N consecutive fields.
+
+	class Writer;	// In-place frame encoder.
+	class Encoded;	// Frame encoded ahead of time.
+
 	/* Communication Type Interface Specifiers */
 	class INP;
 	class OTP;
@@ -67,7 +80,7 @@ public:
 
 	typedef uint16_t 	U2;
 	typedef int16_t 	I2;
-	#ifdef __ARMEL__
+	#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
 	typedef uint16_t	E2;
 	typedef uint16_t 	X2;
 	typedef uint32_t	U4;
@@ -83,6 +96,18 @@ public:
 
 	static U2 getPayloadLen(const std::vector<uint8_t> & ubx);	// Extracts a UBX frame length specifier value from a frame hex vector.
 
+	inline U1 getClass() const { return msgClass; }
+	inline U1 getID() const { return msgID; }
+
+	/* Received Payload Access */
+	inline bool valid() const { return payload != nullptr; }
+
+	template<typename T, size_t Offset>
+	inline T get(Field<T, Offset> f) const { return f.get(payload); }
+
+	template<typename T, size_t Offset, size_t N>
+	inline T get(Array<T, Offset, N> a, size_t i) const { return a.get(payload, i); }	// i < N
+
 	
 protected:
 	static const U1 sync1 = 0xB5;	// 'mu'
@@ -101,31 +126,206 @@ protected:
 
 	} cs;
 
+	const uint8_t * payload = nullptr;	// Payload of the received frame viewed. nullptr if not a view or not matched.
+
 	UBX() = delete;
 	UBX(U1 msgClass, U1 msgID, U2 len = 0);
+	UBX(U1 msgClass, U1 msgID, U2 len, const uint8_t * first, const uint8_t * last);	// View of a received frame.
 
 	std::array<uint8_t, 6> header() const;
+
+	/* Repeated Blocks */
+	// Payloads of fixedLen bytes followed by any number of blocks of blockLen bytes, such as one per satellite. Fields
+	// of a block are declared at their offset within the block.
+	inline U2 blocks(U2 fixedLen, U2 blockLen) const { return valid() ? (len - fixedLen) / blockLen : 0u; }
+
+	template<typename T, size_t Offset>
+	inline T block(U2 fixedLen, U2 blockLen, U2 i, Field<T, Offset> f) const { return f.get(payload + fixedLen + blockLen * i); }
+
+	template<typename T, size_t Offset, size_t N>
+	inline T block(U2 fixedLen, U2 blockLen, U2 i, Array<T, Offset, N> a, size_t j) const { return a.get(payload + fixedLen + blockLen * i, j); }
+
+	StaticString text(U2 offset, U2 width) const;	// Characters of a NUL-padded field, up to the first NUL if any.
+};
+
+
+/**
+ * @brief A field of type T at byte offset Offset within a UBX payload.
+ * 
+ * Messages declare their payload as a list of static constexpr fields, for example:
+ * 		static constexpr Field<I4, 28> lat{};
+ * which are then read from a received frame with get(lat), or written into a payload being built with lat.set().
+ * Fields are little-endian and need not be aligned.
+ */
+template<typename T, size_t Offset>
+struct UBX::Field{
+	using type = T;
+	static constexpr size_t offset = Offset;
+	static constexpr size_t end = Offset + sizeof(T);	// One past the last byte of the field.
+
+	static constexpr T get(const uint8_t * payload){
+		if constexpr(std::is_floating_point<T>::value){
+			T v;
+			memcpy(&v, payload + Offset, sizeof(T));	// IEEE 754 values share the integer byte order on all supported targets.
+			return v;
+		}
+		else if constexpr(std::is_same<T, bool>::value) return payload[Offset] != 0u;
+		else{
+			using uT = typename std::make_unsigned<T>::type;
+			uT v = 0u;
+			for(size_t i = 0; i < sizeof(T); i++) v |= static_cast<uT>(payload[Offset + i]) << (8u * i);
+			return static_cast<T>(v);
+		}
+	}
+
+	static constexpr void set(uint8_t * payload, T v){
+		if constexpr(std::is_floating_point<T>::value) memcpy(payload + Offset, &v, sizeof(T));
+		else if constexpr(std::is_same<T, bool>::value) payload[Offset] = v ? 1u : 0u;
+		else{
+			using uT = typename std::make_unsigned<T>::type;
+			for(size_t i = 0; i < sizeof(T); i++) payload[Offset + i] = static_cast<uint8_t>(static_cast<uT>(v) >> (8u * i));
+		}
+	}
+};
+
+/**
+ * @brief N consecutive fields of type T from byte offset Offset within a UBX payload, such as a per-port table.
+ */
+template<typename T, size_t Offset, size_t N>
+struct UBX::Array{
+	using type = T;
+	static constexpr size_t offset = Offset;
+	static constexpr size_t size = N;
+	static constexpr size_t end = Offset + N * sizeof(T);	// One past the last byte of the array.
+
+	static constexpr T get(const uint8_t * payload, size_t i) { return Field<T, Offset>::get(payload + i * sizeof(T)); }
+	static constexpr void set(uint8_t * payload, size_t i, T v) { Field<T, Offset>::set(payload + i * sizeof(T), v); }
+};
+
+/**
+ * @brief Encodes a frame directly into caller-provided storage (e.g. a UART::Tx allocation) in a single pass.
+ * 
+ * The header is written on construction. Payload characters are then appended with put(), accumulating the Fletcher
+ * checksum as they are written, and finish() appends the checksum. The storage must hold len + 8 characters.
+ */
+class UBX::Writer{
+	uint8_t * p;
+	U2 n = 0u;
+	U1 ckA = 0u;
+	U1 ckB = 0u;
+
+public:
+	constexpr Writer(uint8_t * p, U1 msgClass, U1 msgID, U2 len) : p(p) {
+		p[n++] = sync1;
+		p[n++] = sync2;
+		put(msgClass);
+		put(msgID);
+		put(len);
+	}
+
+	constexpr void put(uint8_t c){
+		p[n++] = c;
+		ckA += c;
+		ckB += ckA;
+	}
+
+	template<typename T>
+	constexpr void put(T v){	// Little-endian, as per Field.
+		Field<T, 0>::set(p + n, v);
+		for(size_t i = 0; i < sizeof(T); i++) put(p[n]);
+	}
+
+	constexpr U2 finish(){	// Appends the checksum. Returns the size of the frame written.
+		p[n++] = ckA;
+		p[n++] = ckB;
+		return n;
+	}
 };
 
+/**
+ * @brief A complete frame encoded ahead of time, such as a constant built by UBX::CFG::VAL::SET::encode().
+ * 
+ * Sent in the same way as a message which is encoded upon transmission.
+ */
+class UBX::Encoded{
+	const uint8_t * frame;
+	U2 n;
+
+public:
+	template<size_t N>
+	constexpr Encoded(const std::array<uint8_t, N> & frame) : frame(frame.data()), n(N) {}
+
+	inline U1 getClass() const { return frame[2]; }
+	inline U1 getID() const { return frame[3]; }
+	inline U2 frameSize() const { return n; }
+	inline const uint8_t * begin() const { return frame; }
+	inline const uint8_t * end() const { return frame + n; }
+	inline U2 serialize(uint8_t * p) const {
+		memcpy(p, frame, n);
+		return n;
+	}
+};
 
 class UBX::SEC : public UBX{
 public:
 	class UNIQID;
+
+	static const U1 classID = 0x27u;
+
+protected:
+	SEC(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, len, first, last) {}
 };
 
+/**
+ * @brief Unique Chip ID (UBX-SEC-UNIQID).
+ */
 class UBX::SEC::UNIQID : public UBX::SEC{
 public:
-	UNIQID(const vect & ubx);
+	static const U1 ID = 0x03u;
+	static const U2 payloadLen = 9u;
+
+	static constexpr Field<U1, 0>		version{};	// Message Version (0x01)
+	static constexpr Array<U1, 4, 5>	uniqueId{};	// Unique Chip ID, most significant byte first
+
+	UNIQID(const uint8_t * first, const uint8_t * last) : SEC(ID, payloadLen, first, last) {}
 };
 
 class UBX::UPD : public UBX{
 public:
 	class SOS;
+
+	static const U1 classID = 0x09u;
+
+protected:
+	UPD(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, len, first, last) {}
 };
 
+/**
+ * @brief Backup File in Flash, Save on Shutdown (UBX-UPD-SOS).
+ * 
+ * Commands to create or clear the backup are 4 bytes long. The receiver answers a create command, and reports the
+ * restoration upon startup, with 8 bytes carrying a response.
+ */
 class UBX::UPD::SOS : public UBX::UPD{
 public:
-	SOS(const vect & ubx);
+	static const U1 ID = 0x14u;
+	static const U2 payloadLen = 4u;		// Commands
+	static const U2 responseLen = 8u;		// Acknowledgement and restoration report
+
+	enum class Cmd : U1{
+		CREATE		= 0u,	// Create Backup File in Flash
+		CLEAR		= 1u,	// Clear Backup File in Flash
+		ACK			= 2u,	// Backup File Creation Acknowledge (output)
+		RESTORED	= 3u	// System Restored from Backup (output)
+	};
+
+	static constexpr Field<U1, 0>	cmd{};			// See Cmd
+	static constexpr Field<U1, 4>	response{};		// ACK: 0 Not Acknowledged, 1 Acknowledged. RESTORED: 0 Unknown,
+													// 1 Failed, 2 Restored, 3 Not Restored (no backup).
+
+	SOS(const uint8_t * first, const uint8_t * last) : UPD(ID, payloadLen, first, last) {}
+
+	inline bool hasResponse() const { return valid() && (len >= responseLen); }	// Whether response may be read.
 };
 
 #include "UBX_CFG.hpp"
@@ -24,21 +24,27 @@ class UBX::ACKNAK : public UBX{
 public:
 	class ACK;
 	class NAK;
-protected:
-	uint8_t ackClsID;	//Class ID of Acknowledged/Not Acknowledged Message.
-	uint8_t ackMsgID;	//Message ID of Acknowledged/Not Acknowledged Message.
 
-	ACKNAK(const vect & ubx);
+	static const U1 classID = 0x05u;
+	static const U2 payloadLen = 2u;
+
+	static constexpr Field<U1, 0> ackClsID{};	// Class ID of Acknowledged/Not Acknowledged Message.
+	static constexpr Field<U1, 1> ackMsgID{};	// Message ID of Acknowledged/Not Acknowledged Message.
+
+protected:
+	ACKNAK(U1 msgID, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, payloadLen, first, last) {}
 };
 
 class UBX::ACKNAK::ACK : public ACKNAK{
 public:
-	ACK(const vect & ubx);
+	static const U1 ID = 0x01u;
+	ACK(const uint8_t * first, const uint8_t * last) : ACKNAK(ID, first, last) {}
 };
 
 class UBX::ACKNAK::NAK : public ACKNAK{
 public:
-	NAK(const vect & ubx);
+	static const U1 ID = 0x00u;
+	NAK(const uint8_t * first, const uint8_t * last) : ACKNAK(ID, first, last) {}
 };
 
 
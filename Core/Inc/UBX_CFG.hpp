@@ -52,6 +52,8 @@ public:
 	// class USB;			// Depricated
 	class VAL;
 
+	static const U1 classID = 0x06u;
+
 private:
 
 };
@@ -79,7 +81,7 @@ public:
 		APPLY			= 0x03u
 	};
 
-		struct KeyID{
+	struct KeyID{
 		enum class Size : uint8_t{
 			BIT = 0x01u,	// 1-bit (will use 1 byte of storage, LSB significant)
 			BYTE = 0x02,	// 1-byte
@@ -91,52 +93,83 @@ public:
 		U1 groupID;
 		U2 itemID;
 
-		X4 toKey() const;
+		constexpr X4 toKey() const {
+			return ( ( ((X4)size) << 28 ) | ( ((X4)groupID) << 16 ) | ( ((X4)itemID) ) );
+		}
+
+		constexpr uint8_t valueSize() const {	// Size of the key's value. 0 if invalid.
+			switch(size){
+				case Size::BIT:		return 1u;
+				case Size::BYTE:	return 1u;
+				case Size::WORD:	return 2u;
+				case Size::DOUBLE:	return 4u;
+				case Size::QUAD:	return 8u;
+				default: return 0u;
+			}
+		}
 		
 		KeyID() = default;
 
 		constexpr KeyID(Size size, U1 groupID, U2 itemID) : 
 			size(size), groupID(groupID), itemID(itemID) {}
-		constexpr KeyID(U4 && key) : 
+		constexpr KeyID(U4 key) : 
 			size(static_cast<Size>( (key & (0b111u << 28)) >> 28 )),
 			groupID((key & (0xFFu << 16)) >> 16),
 			itemID((key & 0xFFFu)) {}
 	};
 
+	/**
+	 * @brief A KeyID which carries the type of its value.
+	 * 
+	 * Keys are declared as constants (see UBX_CFG_KEYID.hpp), where a type of the wrong size for the key fails to compile.
+	 */
+	template<typename T>
+	struct Key : KeyID{
+		using type = T;
+
+		constexpr Key(U4 key) : KeyID(key) {
+			if(valueSize() != sizeof(T)) sizeMismatch();	// Not a constant expression, so a compile-time error.
+		}
+
+	private:
+		static void sizeMismatch();	// Deliberately undefined.
+	};
+
+	/**
+	 * @brief A key with its value, as encoded. Constant pairs are constant expressions, so tables of them (and frames
+	 * 		  encoded from them with SET::encode()) are placed in flash.
+	 */
 	struct KeyValuePair{
 		KeyID keyId;
+		UBX::U4 value;	// Little-endian encoding of the value, zero-extended.
 
-		enum{
-			L, U1, I1, E1, X1,	// 1-Byte Sized
-			U2, I2, E2, X2,		// 2-Byte Sized
-			U4, I4, E4, X4, R4	// 4-Byte Sized
-		} tag;
-
-		union{
-			UBX::L l;
-			UBX::U1 u1;
-			UBX::I1 i1;
-			UBX::E1 e1;
-			UBX::X1 x1;
-			UBX::U2 u2;
-			UBX::I2 i2;
-			UBX::E2 e2;
-			UBX::X2 x2;
-			UBX::U4 u4;
-			UBX::I4 i4;
-			UBX::E4 e4;
-			UBX::X4 x4;
-			UBX::R4 r4;
-		};
-
-		uint8_t size() const;
-		std::pair<std::array<uint8_t, 12>, uint8_t> binary() const;	// {array, size occupied}
+		constexpr uint8_t size() const { return keyId.valueSize(); }	// Size of the value alone.
+		constexpr UBX::U4 raw() const { return value; }
+
+		constexpr void write(UBX::Writer & w) const {	// Appends the key and value.
+			w.put(keyId.toKey());
+			for(uint8_t i = 0u; i < size(); i++) w.put(static_cast<uint8_t>( (i < 4u) ? (value >> (8u * i)) : 0u ));
+		}
 
 		KeyValuePair() = default;
 
 		template<typename T>
-		KeyValuePair(KeyID key, T val);
+		constexpr KeyValuePair(Key<T> key, typename Key<T>::type val) : keyId(key), value(encode(val)) {
+			static_assert(sizeof(T) <= sizeof(value), "Values wider than 4 bytes are not supported.");
+		}
 
+	private:
+		template<typename T>
+		static constexpr UBX::U4 encode(T v){
+			if constexpr(std::is_enum<T>::value) return encode(static_cast<typename std::underlying_type<T>::type>(v));
+			else if constexpr(std::is_same<T, bool>::value) return v ? 1u : 0u;
+			else if constexpr(std::is_floating_point<T>::value){	// R4. Never a constant expression.
+				UBX::U4 u = 0u;
+				memcpy(&u, &v, sizeof(u));
+				return u;
+			}
+			else return static_cast<UBX::U4>(static_cast<typename std::make_unsigned<T>::type>(v));
+		}
 	};
 
 	enum class CFG_PM_OPERATEMODE : UBX::E1{
@@ -189,31 +222,64 @@ public:
 		DEFAULT = 7u
 	};
 
+	static const U1 ID = 0x8Bu;
+
 protected:
-	GET() : UBX(0x06, 0x8B) {}
+	GET(U2 len = 0) : UBX(classID, ID, len) {}
+	GET(U2 len, const uint8_t * first, const uint8_t * last) : UBX(classID, ID, len, first, last) {}
 };
 
+/**
+ * @brief Polls the values of up to maxKeys keys held elsewhere.
+ * 
+ * The receiver responds with POLLED, followed by UBX-ACK-ACK, or UBX-ACK-NAK if any key is unknown. The keys are only
+ * referenced, and must remain valid until the frame is serialized.
+ */
 class UBX::CFG::VAL::GET::POLL_REQ : public UBX::CFG::VAL::GET {
 private:
-	const U1 version = 0x00;
 	Layer layer;
 	U2 position;
-	std::pair<std::array<KeyID, 64>, uint8_t> cfgData; // {key array, no of keys}
+	const KeyID * first;
+	const KeyID * last;
 
 public:
-	POLL_REQ(KeyID key);
-	POLL_REQ(std::vector<KeyID> keys);
-};
+	static const uint8_t maxKeys = 64u;
 
-class UBX::CFG::VAL::GET::POLLED : public UBX::CFG {
-private:
-	const U1 version = 0x01;
-	Layer layer;
-	U2 position;
-	std::pair<std::array<KeyValuePair, 64>, uint8_t> cfgData; // {key array, no of keys}
+	POLL_REQ(const KeyID * first, const KeyID * last, Layer layer = Layer::RAM, U2 position = 0u) :
+		GET(4u + 4u * (last - first)), layer(layer), position(position), first(first), last(last) {}
+
+	inline U2 frameSize() const { return len + 8u; }
+	U2 serialize(uint8_t * p) const;
+};
 
+/**
+ * @brief View of a received response to POLL_REQ.
+ */
+class UBX::CFG::VAL::GET::POLLED : public UBX::CFG::VAL::GET {
 public:
-	POLLED(const vect & ubx);
+	static constexpr Field<U1, 0> version{};
+	static constexpr Field<U1, 1> layer{};
+	static constexpr Field<U2, 2> position{};
+
+	POLLED(const uint8_t * first, const uint8_t * last) : GET(4u, first, last) {}
+
+	/**
+	 * @brief Calls f(X4 key, U4 value) for each key-value pair, in order. Values wider than 4 bytes are truncated.
+	 */
+	template<typename F>
+	void forEach(F f) const {
+		if(!valid()) return;
+		for(U2 i = 4u; i + 4u <= len; ){
+			const X4 key = Field<X4, 0>::get(payload + i);
+			const uint8_t n = KeyID(key).valueSize();
+			if( (n == 0u) || (i + 4u + n > len) ) return;	// Malformed
+
+			U4 value = 0u;
+			for(uint8_t k = 0u; (k < n) && (k < 4u); k++) value |= static_cast<U4>(payload[i + 4u + k]) << (8u * k);
+			f(key, value);
+			i += 4u + n;
+		}
+	}
 };
 
 class UBX::CFG::VAL::SET : public UBX {
@@ -226,6 +292,8 @@ public:
 		FLSH 	= 0x04,	// "FLASH" was used by a macro
 	};
 
+	static const U1 ID = 0x8Au;
+
 protected:
 	const U1 version = 0x00u;
 	Layers layers;
@@ -236,20 +304,78 @@ protected:
 	std::pair<std::array<KeyValuePair, 64>, uint8_t> cfgData;	// {array, no of keys used}
 
 private:
-	SET() : UBX(0x06, 0x8A, 4) {};
+	SET() : UBX(classID, ID, 4) {};
 
 public:
-	SET(KeyValuePair cfg, Layers layers = Layers::RAM) : UBX(0x06, 0x8A, cfg.size() + 4), layers(layers) { cfgData.first[cfgData.second++] = cfg; }
-
-	void push(KeyValuePair cfg);	
-	std::pair<std::array<uint8_t, 6+64*12>, uint8_t> binary() const noexcept ;
+	static const uint8_t maxKeys = 64u;
+
+	SET(const KeyValuePair & cfg, Layers layers = Layers::RAM) : UBX(classID, ID, 4u + 4u + cfg.size()), layers(layers) { cfgData.first[0] = cfg; cfgData.second = 1u; }
+
+	bool push(const KeyValuePair & cfg);	// False if full.
+
+	inline U2 frameSize() const { return len + 8u; }
+	U2 serialize(uint8_t * p) const;
+
+	/* Encoding of Key-Value Pairs held elsewhere (e.g. a constant table), without constructing a SET */
+	static constexpr U2 frameSize(const KeyValuePair * first, const KeyValuePair * last){
+		U2 n = 8u + 4u;	// Framing, then version, layers and reserved.
+		for(; first != last; first++) n += 4u + first->size();
+		return n;
+	}
+
+	/**
+	 * @brief Encodes a frame setting the key-value pairs [first, last) in a single pass.
+	 * 
+	 * @param p			Storage for frameSize(first, last) characters.
+	 * @param action	The frame's part in a transaction, if any.
+	 * @return U2 The number of characters written.
+	 */
+	static constexpr U2 serialize(uint8_t * p, Layers layers, const KeyValuePair * first, const KeyValuePair * last,
+		Action action = Action::TRANSACTIONLESS){
+		UBX::Writer w(p, classID, ID, frameSize(first, last) - 8u);
+		w.put(static_cast<U1>( (action == Action::TRANSACTIONLESS) ? 0x00u : 0x01u ));	// Version
+		w.put(static_cast<U1>(layers));
+		w.put(static_cast<U1>(action));	// Reserved in version 0x00.
+		w.put(static_cast<U1>(0x00u));	// Reserved
+		for(; first != last; first++) first->write(w);
+		return w.finish();
+	}
+
+	/**
+	 * @brief The complete frame setting a constant table of key-value pairs, encoded at compile time. For example:
+	 * 		static constexpr KeyValuePair profile[] = { {CFG_RATE_MEAS, 100u} };
+	 * 		static constexpr auto frame = SET::encode<profile>();
+	 * which may then be sent as a UBX::Encoded.
+	 */
+	template<const auto & Profile, Layers L = Layers::RAM>
+	static constexpr auto encode(){
+		constexpr U2 n = frameSize(std::begin(Profile), std::end(Profile));
+		std::array<uint8_t, n> frame{};
+		serialize(frame.data(), L, std::begin(Profile), std::end(Profile));
+		return frame;
+	}
 };
 
-class UBX::CFG::VAL::SET::TRANSACTION : public UBX::CFG::VAL::SET {
+/**
+ * @brief One frame of a transaction, setting key-value pairs held elsewhere.
+ * 
+ * A transaction is a RE_START frame, any number of ONGOING frames and an APPLY frame. The receiver applies the keys of
+ * all frames together upon APPLY, or none of them if any frame is rejected. The key-value pairs are only referenced,
+ * and must remain valid until the frame is serialized.
+ */
+class UBX::CFG::VAL::SET::TRANSACTION : public UBX {
 private:
+	Layers layers;
 	Action action;
+	const KeyValuePair * first;
+	const KeyValuePair * last;
+
+public:
+	TRANSACTION(Action action, const KeyValuePair * first, const KeyValuePair * last, Layers layers = Layers::RAM) :
+		UBX(classID, ID, CFG::VAL::SET::frameSize(first, last) - 8u), layers(layers), action(action), first(first), last(last) {}
 
-	TRANSACTION(Layers layers, Action action, std::array<KeyValuePair, 64> cfgData);
+	inline U2 frameSize() const { return len + 8u; }
+	inline U2 serialize(uint8_t * p) const { return CFG::VAL::SET::serialize(p, layers, first, last, action); }
 };
 
 #include "UBX_CFG_KEYID.hpp"	// KeyId Constant Expressions
@@ -20,6 +20,10 @@
 
 #include "UBX.hpp"
 
+/**
+ * Information messages carry a single string of any length, which is viewed without copying. The frame must outlive
+ * the view.
+ */
 class UBX::INF : public UBX{
 public:
 	class DBG;		// "DEBUG" conflicts with a common define.
@@ -27,31 +31,49 @@ public:
 	class NOTICE;
 	class TEST;
 	class WARNING;
+
+	static const U1 classID = 0x04u;
+	static const U2 payloadLen = 0u;	// Without any characters.
+
+	inline StaticString str() const { return text(0u, blocks(payloadLen, 1u)); }
+
+protected:
+	INF(U1 msgID, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, payloadLen, first, last) {}
 };
 
 class UBX::INF::DBG : public UBX::INF{
 public:	
-	DBG(const vect & ubx);
+	static const U1 ID = 0x04u;
+
+	DBG(const uint8_t * first, const uint8_t * last) : INF(ID, first, last) {}
 };
 
 class UBX::INF::ERROR : public UBX::INF{
 public:	
-	ERROR(const vect & ubx);
+	static const U1 ID = 0x00u;
+
+	ERROR(const uint8_t * first, const uint8_t * last) : INF(ID, first, last) {}
 };
 
 class UBX::INF::NOTICE : public UBX::INF{
 public:	
-	NOTICE(const vect & ubx);
+	static const U1 ID = 0x02u;
+
+	NOTICE(const uint8_t * first, const uint8_t * last) : INF(ID, first, last) {}
 };
 
 class UBX::INF::TEST : public UBX::INF{
 public:	
-	TEST(const vect & ubx);
+	static const U1 ID = 0x03u;
+
+	TEST(const uint8_t * first, const uint8_t * last) : INF(ID, first, last) {}
 };
 
 class UBX::INF::WARNING : public UBX::INF{
 public:	
-	WARNING(const vect & ubx);
+	static const U1 ID = 0x01u;
+
+	WARNING(const uint8_t * first, const uint8_t * last) : INF(ID, first, last) {}
 };
 
 /*** END OF FILE ***/
\ No newline at end of file
@@ -34,51 +34,266 @@ public:
 	class RETRIEVE_STRING;
 	class STRING;
 	
+	static const U1 classID = 0x21u;
+
+protected:
+	LOG(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, len, first, last) {}
 };
 
+/**
+ * @brief Batched Data (UBX-LOG-BATCH), one epoch of the batching buffer. Laid out as NAV-PVT, with the odometer.
+ */
 class UBX::LOG::BATCH : public UBX::LOG{
 public:
-	BATCH(const vect & ubx);
+	static const U1 ID = 0x11u;
+	static const U2 payloadLen = 100u;
+
+	static constexpr Field<U1, 0>	version{};			// Message Version (0x00)
+	static constexpr Field<X1, 1>	contentValid{};		// Extra PVT and Odometer Data Valid
+	static constexpr Field<U2, 2>	msgCnt{};			// Message Counter
+	static constexpr Field<U4, 4>	iTOW{};				// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U2, 8>	year{};				// Year (UTC)
+	static constexpr Field<U1, 10>	month{};			// Month (UTC, 1..12)
+	static constexpr Field<U1, 11>	day{};				// Day of Month (UTC, 1..31)
+	static constexpr Field<U1, 12>	hour{};				// Hour of Day (UTC, 0..23)
+	static constexpr Field<U1, 13>	min{};				// Minute of Hour (UTC, 0..59)
+	static constexpr Field<U1, 14>	sec{};				// Seconds of Minute (UTC, 0..60)
+	static constexpr Field<X1, 15>	valid{};			// Validity Flags: Date, Time
+	static constexpr Field<U4, 16>	tAcc{};				// Time Accuracy Estimate (ns)
+	static constexpr Field<I4, 20>	fracSec{};			// Fraction of Second (ns, -1e9..1e9)
+	static constexpr Field<E1, 24>	fixType{};			// See NAV::PVT::FixType
+	static constexpr Field<X1, 25>	flags{};			// Fix Status Flags
+	static constexpr Field<X1, 26>	flags2{};			// Additional Flags
+	static constexpr Field<U1, 27>	numSV{};			// Satellites used in the Solution
+	static constexpr Field<I4, 28>	lon{};				// Longitude (1e-7 deg)
+	static constexpr Field<I4, 32>	lat{};				// Latitude (1e-7 deg)
+	static constexpr Field<I4, 36>	height{};			// Height above Ellipsoid (mm)
+	static constexpr Field<I4, 40>	hMSL{};				// Height above Mean Sea Level (mm)
+	static constexpr Field<U4, 44>	hAcc{};				// Horizontal Accuracy Estimate (mm)
+	static constexpr Field<U4, 48>	vAcc{};				// Vertical Accuracy Estimate (mm)
+	static constexpr Field<I4, 52>	velN{};				// North Velocity (mm/s)
+	static constexpr Field<I4, 56>	velE{};				// East Velocity (mm/s)
+	static constexpr Field<I4, 60>	velD{};				// Down Velocity (mm/s)
+	static constexpr Field<I4, 64>	gSpeed{};			// Ground Speed, 2-D (mm/s)
+	static constexpr Field<I4, 68>	headMot{};			// Heading of Motion, 2-D (1e-5 deg)
+	static constexpr Field<U4, 72>	sAcc{};				// Speed Accuracy Estimate (mm/s)
+	static constexpr Field<U4, 76>	headAcc{};			// Heading Accuracy Estimate (1e-5 deg)
+	static constexpr Field<U2, 80>	pDOP{};				// Position DOP (0.01)
+	static constexpr Field<U4, 84>	distance{};			// Ground Distance since the last Reset (m)
+	static constexpr Field<U4, 88>	totalDistance{};	// Total Cumulative Ground Distance (m)
+	static constexpr Field<U4, 92>	distanceStd{};		// Ground Distance Accuracy, 1-sigma (m)
+
+	BATCH(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
 };
+
+/**
+ * @brief Create Log File (UBX-LOG-CREATE).
+ */
 class UBX::LOG::CREATE : public UBX::LOG{
 public:
-	CREATE(const vect & ubx);
+	static const U1 ID = 0x07u;
+	static const U2 payloadLen = 8u;
+
+	enum class Size : U1{
+		MAXIMUM	= 0u,	// Largest Possible
+		MINIMUM	= 1u,
+		USER	= 2u	// userDefinedSize
+	};
+
+	static constexpr Field<U1, 0>	version{};			// Message Version (0x00)
+	static constexpr Field<X1, 1>	logCfg{};			// Bit 0: Circular Log
+	static constexpr Field<U1, 3>	logSize{};			// See Size
+	static constexpr Field<U4, 4>	userDefinedSize{};	// Log Size, for Size::USER (bytes)
+
+	CREATE(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
 };
+
+/**
+ * @brief Erase Logged Data (UBX-LOG-ERASE). A command without payload.
+ */
 class UBX::LOG::ERASE : public UBX::LOG{
 public:
-	ERASE(const vect & ubx);
+	static const U1 ID = 0x03u;
+	static const U2 payloadLen = 0u;
+
+	ERASE(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
 };
+
+/**
+ * @brief Find Index of a Log Entry from a Given Time (UBX-LOG-FINDTIME).
+ * 
+ * This class views the response. The request, a different payload with the same class and ID, is laid out by Request.
+ */
 class UBX::LOG::FINDTIME : public UBX::LOG{
 public:
-	FINDTIME(const vect & ubx);
+	static const U1 ID = 0x0Eu;
+	static const U2 payloadLen = 8u;
+
+	struct Request{
+		static const U2 payloadLen = 12u;
+
+		static constexpr Field<U1, 0>	version{};	// Message Version (0x00)
+		static constexpr Field<U1, 1>	type{};		// Message Type (0 Request)
+		static constexpr Field<U2, 4>	year{};		// Year (UTC, 1..65635)
+		static constexpr Field<U1, 6>	month{};	// Month (UTC, 1..12)
+		static constexpr Field<U1, 7>	day{};		// Day of Month (UTC, 1..31)
+		static constexpr Field<U1, 8>	hour{};		// Hour of Day (UTC, 0..23)
+		static constexpr Field<U1, 9>	minute{};	// Minute of Hour (UTC, 0..59)
+		static constexpr Field<U1, 10>	second{};	// Seconds of Minute (UTC, 0..60)
+	};
+
+	static constexpr Field<U1, 0>	version{};		// Message Version (0x01)
+	static constexpr Field<U1, 1>	type{};			// Message Type (1 Response)
+	static constexpr Field<U4, 4>	entryNumber{};	// Index of the First Entry at or after the Time Requested, 0xFFFFFFFF if none
+
+	FINDTIME(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
 };
+
+/**
+ * @brief Log Information (UBX-LOG-INFO).
+ */
 class UBX::LOG::INFO : public UBX::LOG{
 public:
-	INFO(const vect & ubx);
+	static const U1 ID = 0x08u;
+	static const U2 payloadLen = 48u;
+
+	static constexpr Field<U1, 0>	version{};				// Message Version (0x01)
+	static constexpr Field<U4, 4>	filestoreCapacity{};	// Capacity of the Filestore (bytes)
+	static constexpr Field<U4, 16>	currentMaxLogSize{};	// Maximum Size the Current Log may Reach (bytes)
+	static constexpr Field<U4, 20>	currentLogSize{};		// Size of the Current Log (bytes)
+	static constexpr Field<U4, 24>	entryCount{};			// Number of Entries in the Log
+	static constexpr Field<U2, 28>	oldestYear{};			// Oldest Entry Time (UTC, 0 if none)
+	static constexpr Field<U1, 30>	oldestMonth{};
+	static constexpr Field<U1, 31>	oldestDay{};
+	static constexpr Field<U1, 32>	oldestHour{};
+	static constexpr Field<U1, 33>	oldestMinute{};
+	static constexpr Field<U1, 34>	oldestSecond{};
+	static constexpr Field<U2, 36>	newestYear{};			// Newest Entry Time (UTC, 0 if none)
+	static constexpr Field<U1, 38>	newestMonth{};
+	static constexpr Field<U1, 39>	newestDay{};
+	static constexpr Field<U1, 40>	newestHour{};
+	static constexpr Field<U1, 41>	newestMinute{};
+	static constexpr Field<U1, 42>	newestSecond{};
+	static constexpr Field<X1, 44>	status{};				// Recording, Inactive, Circular
+
+	INFO(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
 };
+
+/**
+ * @brief Request Log Data (UBX-LOG-RETRIEVE). Entries are sent as LOG-RETRIEVEPOS, -RETRIEVEPOSEXTRA and
+ * -RETRIEVESTRING.
+ */
 class UBX::LOG::RETRIEVE : public UBX::LOG{
 public:
-	RETRIEVE(const vect & ubx);
+	static const U1 ID = 0x09u;
+	static const U2 payloadLen = 12u;
+
+	static constexpr Field<U4, 0>	startNumber{};	// Index of the First Entry to Retrieve
+	static constexpr Field<U4, 4>	entryCount{};	// Number of Entries to Retrieve (at most 256)
+	static constexpr Field<U1, 8>	version{};		// Message Version (0x00)
+
+	RETRIEVE(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
 };
+
+/**
+ * @brief Request Batch Data (UBX-LOG-RETRIEVEBATCH). Epochs are sent as LOG-BATCH.
+ */
 class UBX::LOG::RETRIEVE_BATCH : public UBX::LOG{
 public:
-	RETRIEVE_BATCH(const vect & ubx);
+	static const U1 ID = 0x10u;
+	static const U2 payloadLen = 4u;
+
+	static constexpr Field<U1, 0>	version{};	// Message Version (0x00)
+	static constexpr Field<X1, 1>	flags{};	// Bit 0: Send MON-BATCH before the Batched Data
+
+	RETRIEVE_BATCH(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
 };
+
+/**
+ * @brief Position Fix Log Entry (UBX-LOG-RETRIEVEPOS).
+ */
 class UBX::LOG::RETRIEVE_POS : public UBX::LOG{
 public:
-	RETRIEVE_POS(const vect & ubx);
+	static const U1 ID = 0x0Bu;
+	static const U2 payloadLen = 40u;
+
+	static constexpr Field<U4, 0>	entryIndex{};	// Index of the Entry
+	static constexpr Field<I4, 4>	lon{};			// Longitude (1e-7 deg)
+	static constexpr Field<I4, 8>	lat{};			// Latitude (1e-7 deg)
+	static constexpr Field<I4, 12>	hMSL{};			// Height above Mean Sea Level (mm)
+	static constexpr Field<U4, 16>	hAcc{};			// Horizontal Accuracy Estimate (mm)
+	static constexpr Field<U4, 20>	gSpeed{};		// Ground Speed, 2-D (mm/s)
+	static constexpr Field<U4, 24>	heading{};		// Heading of Motion, 2-D (1e-5 deg)
+	static constexpr Field<U1, 28>	version{};		// Message Version (0x00)
+	static constexpr Field<E1, 29>	fixType{};		// 2 2D-Fix, 3 3D-Fix, 4 GNSS + Dead Reckoning
+	static constexpr Field<U2, 30>	year{};			// Year (UTC, 1..65635)
+	static constexpr Field<U1, 32>	month{};		// Month (UTC, 1..12)
+	static constexpr Field<U1, 33>	day{};			// Day of Month (UTC, 1..31)
+	static constexpr Field<U1, 34>	hour{};			// Hour of Day (UTC, 0..23)
+	static constexpr Field<U1, 35>	minute{};		// Minute of Hour (UTC, 0..59)
+	static constexpr Field<U1, 36>	second{};		// Seconds of Minute (UTC, 0..60)
+	static constexpr Field<U1, 38>	numSV{};		// Satellites used in the Solution
+
+	RETRIEVE_POS(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
 };
+
+/**
+ * @brief Odometer Log Entry (UBX-LOG-RETRIEVEPOSEXTRA).
+ */
 class UBX::LOG::RETRIEVE_POS_EXTRA : public UBX::LOG{
 public:
-	RETRIEVE_POS_EXTRA(const vect & ubx);
+	static const U1 ID = 0x0Fu;
+	static const U2 payloadLen = 32u;
+
+	static constexpr Field<U4, 0>	entryIndex{};	// Index of the Entry
+	static constexpr Field<U1, 4>	version{};		// Message Version (0x00)
+	static constexpr Field<U2, 6>	year{};			// Year (UTC, 1..65635)
+	static constexpr Field<U1, 8>	month{};		// Month (UTC, 1..12)
+	static constexpr Field<U1, 9>	day{};			// Day of Month (UTC, 1..31)
+	static constexpr Field<U1, 10>	hour{};			// Hour of Day (UTC, 0..23)
+	static constexpr Field<U1, 11>	minute{};		// Minute of Hour (UTC, 0..59)
+	static constexpr Field<U1, 12>	second{};		// Seconds of Minute (UTC, 0..60)
+	static constexpr Field<U4, 16>	distance{};		// Odometer Distance (m)
+
+	RETRIEVE_POS_EXTRA(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
 };
+
+/**
+ * @brief Byte String Log Entry (UBX-LOG-RETRIEVESTRING). The bytes are viewed without copying.
+ */
 class UBX::LOG::RETRIEVE_STRING : public UBX::LOG{
 public:
-	RETRIEVE_STRING(const vect & ubx);
+	static const U1 ID = 0x0Du;
+	static const U2 payloadLen = 16u;	// Without any bytes.
+
+	static constexpr Field<U4, 0>	entryIndex{};	// Index of the Entry
+	static constexpr Field<U1, 4>	version{};		// Message Version (0x00)
+	static constexpr Field<U2, 6>	year{};			// Year (UTC, 1..65635)
+	static constexpr Field<U1, 8>	month{};		// Month (UTC, 1..12)
+	static constexpr Field<U1, 9>	day{};			// Day of Month (UTC, 1..31)
+	static constexpr Field<U1, 10>	hour{};			// Hour of Day (UTC, 0..23)
+	static constexpr Field<U1, 11>	minute{};		// Minute of Hour (UTC, 0..59)
+	static constexpr Field<U1, 12>	second{};		// Seconds of Minute (UTC, 0..60)
+	static constexpr Field<U2, 14>	byteCount{};	// Size of the String (bytes)
+
+	RETRIEVE_STRING(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
+
+	inline StaticString bytes() const {	// byteCount bytes, if the frame is long enough to hold them all.
+		return text(payloadLen, (get(byteCount) < blocks(payloadLen, 1u)) ? get(byteCount) : blocks(payloadLen, 1u));
+	}
 };
+
+/**
+ * @brief Store Arbitrary String in the Log (UBX-LOG-STRING). The payload is the string of 1..256 bytes.
+ */
 class UBX::LOG::STRING : public UBX::LOG{
 public:
-	STRING(const vect & ubx);
+	static const U1 ID = 0x04u;
+	static const U2 payloadLen = 0u;	// Without any bytes.
+
+	STRING(const uint8_t * first, const uint8_t * last) : LOG(ID, payloadLen, first, last) {}
+
+	inline StaticString bytes() const { return text(0u, blocks(payloadLen, 1u)); }
 };
 
 /*** END OF FILE ***/
\ No newline at end of file
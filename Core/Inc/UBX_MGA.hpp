@@ -20,6 +20,14 @@
 
 #include "UBX.hpp"
 
+/**
+ * Assistance (MGA) messages are normally uploaded as ready-framed data from an assistance service or a database
+ * previously polled with MGA-DBD, without being decoded. The schemas below are for inspecting and building them, and
+ * for the MGA-ACK returned per message uploaded.
+ * 
+ * Each GNSS message carries several types of data, told apart by the type field leading the payload, each type being
+ * of a different length.
+ */
 class UBX::MGA : public UBX{
 public:
 	class ACK;
@@ -32,51 +40,339 @@ public:
 	class INI;
 	class QZSS;
 	
+	static const U1 classID = 0x13u;
+
+protected:
+	MGA(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, len, first, last) {}
 };
 
+/**
+ * @brief Assistance Data Acknowledgement (UBX-MGA-ACK-DATA0). Enabled by CFG-NAVSPG-ACKAIDING.
+ */
 class UBX::MGA::ACK : public UBX::MGA{
 public:
-	ACK(const vect & ubx);
+	static const U1 ID = 0x60u;
+	static const U2 payloadLen = 8u;
+
+	enum class InfoCode : U1{
+		ACCEPTED		= 0u,
+		NO_TIME			= 1u,	// Receiver does not know the time, so could not use the data.
+		VERSION			= 2u,	// Message version not supported.
+		SIZE			= 3u,	// Message size does not match the version.
+		STORE_FAILED	= 4u,	// Data could not be stored in the database.
+		NOT_READY		= 5u,	// Receiver not ready to use the message.
+		TYPE			= 6u	// Message type unknown.
+	};
+
+	static constexpr Field<U1, 0>		type{};				// 0 Not Used, 1 Accepted
+	static constexpr Field<U1, 1>		version{};			// Message Version (0x00)
+	static constexpr Field<U1, 2>		infoCode{};			// See InfoCode
+	static constexpr Field<U1, 3>		msgId{};			// Message Identifier of the Message Acknowledged
+	static constexpr Array<U1, 4, 4>	msgPayloadStart{};	// First 4 Bytes of the Payload Acknowledged
+
+	ACK(const uint8_t * first, const uint8_t * last) : MGA(ID, payloadLen, first, last) {}
+
+	inline bool accepted() const { return get(type) == 1u; }
 };
 
+/**
+ * @brief AssistNow Offline Data (UBX-MGA-ANO), for one satellite on one day.
+ */
 class UBX::MGA::ANO : public UBX::MGA{
 public:
-	ANO(const vect & ubx);
+	static const U1 ID = 0x20u;
+	static const U2 payloadLen = 76u;
+
+	static constexpr Field<U1, 0>		type{};		// Message Type (0x00)
+	static constexpr Field<U1, 1>		version{};	// Message Version (0x00)
+	static constexpr Field<U1, 2>		svId{};		// Satellite Identifier
+	static constexpr Field<U1, 3>		gnssId{};	// GNSS Identifier
+	static constexpr Field<U1, 4>		year{};		// Years since 2000
+	static constexpr Field<U1, 5>		month{};	// Month (1..12)
+	static constexpr Field<U1, 6>		day{};		// Day of Month (1..31)
+	static constexpr Array<U1, 8, 64>	data{};		// Assistance Data
+
+	ANO(const uint8_t * first, const uint8_t * last) : MGA(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief BeiDou Assistance (UBX-MGA-BDS).
+ */
 class UBX::MGA::BDS : public UBX::MGA{
 public:
-	BDS(const vect & ubx);
+	static const U1 ID = 0x03u;
+	static const U2 payloadLen = 16u;	// Of the shortest type.
+
+	enum class Type : U1{
+		EPH		= 0x01u,	// 88 bytes
+		ALM		= 0x02u,	// 40 bytes
+		HEALTH	= 0x04u,	// 68 bytes
+		UTC		= 0x05u,	// 20 bytes
+		IONO	= 0x06u		// 16 bytes
+	};
+
+	static constexpr Field<U1, 0>	type{};		// See Type
+	static constexpr Field<U1, 1>	version{};	// Message Version (0x00)
+	static constexpr Field<U1, 2>	svId{};		// Satellite Identifier, of EPH and ALM
+
+	BDS(const uint8_t * first, const uint8_t * last) : MGA(ID, payloadLen, first, last) {}
+
+	static constexpr U2 length(Type t){
+		switch(t){
+		case Type::EPH:		return 88u;
+		case Type::ALM:		return 40u;
+		case Type::HEALTH:	return 68u;
+		case Type::UTC:		return 20u;
+		case Type::IONO:	return 16u;
+		default:			return 0u;
+		}
+	}
 };
 
+/**
+ * @brief Navigation Database Dump (UBX-MGA-DBD). Polled from the receiver and later uploaded as is, to restore its
+ * database. The content is opaque.
+ */
 class UBX::MGA::DBD : public UBX::MGA{
 public:
-	DBD(const vect & ubx);
+	static const U1 ID = 0x80u;
+	static const U2 payloadLen = 12u;	// Without any data.
+
+	DBD(const uint8_t * first, const uint8_t * last) : MGA(ID, payloadLen, first, last) {}
+
+	inline U2 size() const { return blocks(payloadLen, 1u); }	// Bytes of data.
+	inline U1 data(U2 i) const { return block(payloadLen, 1u, i, Field<U1, 0>{}); }	// i < size()
 };
 
+/**
+ * @brief Galileo Assistance (UBX-MGA-GAL).
+ */
 class UBX::MGA::GAL : public UBX::MGA{
 public:
-	GAL(const vect & ubx);
+	static const U1 ID = 0x02u;
+	static const U2 payloadLen = 12u;	// Of the shortest type.
+
+	enum class Type : U1{
+		EPH			= 0x01u,	// 76 bytes
+		ALM			= 0x02u,	// 32 bytes
+		TIMEOFFSET	= 0x03u,	// 12 bytes
+		UTC			= 0x05u		// 20 bytes
+	};
+
+	static constexpr Field<U1, 0>	type{};		// See Type
+	static constexpr Field<U1, 1>	version{};	// Message Version (0x00)
+	static constexpr Field<U1, 2>	svId{};		// Satellite Identifier, of EPH and ALM
+
+	GAL(const uint8_t * first, const uint8_t * last) : MGA(ID, payloadLen, first, last) {}
+
+	static constexpr U2 length(Type t){
+		switch(t){
+		case Type::EPH:			return 76u;
+		case Type::ALM:			return 32u;
+		case Type::TIMEOFFSET:	return 12u;
+		case Type::UTC:			return 20u;
+		default:				return 0u;
+		}
+	}
 };
 
+/**
+ * @brief GLONASS Assistance (UBX-MGA-GLO).
+ */
 class UBX::MGA::GLO : public UBX::MGA{
 public:
-	GLO(const vect & ubx);
+	static const U1 ID = 0x06u;
+	static const U2 payloadLen = 20u;	// Of the shortest type.
+
+	enum class Type : U1{
+		EPH			= 0x01u,	// 48 bytes
+		ALM			= 0x02u,	// 36 bytes
+		TIMEOFFSET	= 0x03u		// 20 bytes
+	};
+
+	static constexpr Field<U1, 0>	type{};		// See Type
+	static constexpr Field<U1, 1>	version{};	// Message Version (0x00)
+	static constexpr Field<U1, 2>	svId{};		// Satellite Identifier, of EPH and ALM
+
+	GLO(const uint8_t * first, const uint8_t * last) : MGA(ID, payloadLen, first, last) {}
+
+	static constexpr U2 length(Type t){
+		switch(t){
+		case Type::EPH:			return 48u;
+		case Type::ALM:			return 36u;
+		case Type::TIMEOFFSET:	return 20u;
+		default:				return 0u;
+		}
+	}
 };
 
+/**
+ * @brief GPS Assistance (UBX-MGA-GPS).
+ */
 class UBX::MGA::GPS : public UBX::MGA{
 public:
-	GPS(const vect & ubx);
+	static const U1 ID = 0x00u;
+	static const U2 payloadLen = 16u;	// Of the shortest type.
+
+	enum class Type : U1{
+		EPH		= 0x01u,	// 68 bytes
+		ALM		= 0x02u,	// 36 bytes
+		HEALTH	= 0x04u,	// 40 bytes
+		UTC		= 0x05u,	// 20 bytes
+		IONO	= 0x06u		// 16 bytes
+	};
+
+	static constexpr Field<U1, 0>	type{};		// See Type
+	static constexpr Field<U1, 1>	version{};	// Message Version (0x00)
+	static constexpr Field<U1, 2>	svId{};		// Satellite Identifier, of EPH and ALM
+
+	GPS(const uint8_t * first, const uint8_t * last) : MGA(ID, payloadLen, first, last) {}
+
+	static constexpr U2 length(Type t){
+		switch(t){
+		case Type::EPH:		return 68u;
+		case Type::ALM:		return 36u;
+		case Type::HEALTH:	return 40u;
+		case Type::UTC:		return 20u;
+		case Type::IONO:	return 16u;
+		default:			return 0u;
+		}
+	}
 };
 
+/**
+ * @brief Initial Position, Time, Clock and Earth Orientation Assistance (UBX-MGA-INI).
+ * 
+ * Each type of data is a payload of its own, laid out by the nested schemas.
+ */
 class UBX::MGA::INI : public UBX::MGA{
 public:
-	INI(const vect & ubx);
+	static const U1 ID = 0x40u;
+	static const U2 payloadLen = 12u;	// Of the shortest type.
+
+	struct POS_XYZ;
+	struct POS_LLH;
+	struct UTC_TIME;	// INI-TIME_UTC. "TIME_UTC" is defined by <time.h>.
+	struct GNSS_TIME;	// INI-TIME_GNSS
+	struct CLKD;
+	struct FREQ;
+	struct EOP;
+
+	static constexpr Field<U1, 0>	type{};		// Of the nested schema
+	static constexpr Field<U1, 1>	version{};	// Message Version (0x00)
+
+	INI(const uint8_t * first, const uint8_t * last) : MGA(ID, payloadLen, first, last) {}
+};
+
+struct UBX::MGA::INI::POS_XYZ{	// Initial ECEF Position
+	static const U1 type = 0x00u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<I4, 4>	ecefX{};	// ECEF X Coordinate (cm)
+	static constexpr Field<I4, 8>	ecefY{};	// ECEF Y Coordinate (cm)
+	static constexpr Field<I4, 12>	ecefZ{};	// ECEF Z Coordinate (cm)
+	static constexpr Field<U4, 16>	posAcc{};	// Position Accuracy, Standard Deviation (cm)
 };
 
+struct UBX::MGA::INI::POS_LLH{	// Initial Geodetic Position
+	static const U1 type = 0x01u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<I4, 4>	lat{};		// Latitude (1e-7 deg)
+	static constexpr Field<I4, 8>	lon{};		// Longitude (1e-7 deg)
+	static constexpr Field<I4, 12>	alt{};		// Height above Ellipsoid (cm)
+	static constexpr Field<U4, 16>	posAcc{};	// Position Accuracy, Standard Deviation (cm)
+};
+
+struct UBX::MGA::INI::UTC_TIME{	// Initial UTC Time
+	static const U1 type = 0x10u;
+	static const U2 payloadLen = 24u;
+
+	static constexpr Field<X1, 2>	ref{};		// Time Reference: Receipt (0), EXTINT0 (1) or EXTINT1 (2), Falling Edge, Last
+	static constexpr Field<I1, 3>	leapSecs{};	// Leap Seconds since 1980, -128 if Unknown (s)
+	static constexpr Field<U2, 4>	year{};		// Year
+	static constexpr Field<U1, 6>	month{};	// Month (1..12)
+	static constexpr Field<U1, 7>	day{};		// Day of Month (1..31)
+	static constexpr Field<U1, 8>	hour{};		// Hour of Day (0..23)
+	static constexpr Field<U1, 9>	minute{};	// Minute of Hour (0..59)
+	static constexpr Field<U1, 10>	second{};	// Seconds of Minute (0..60)
+	static constexpr Field<U4, 12>	ns{};		// Nanoseconds (0..999999999)
+	static constexpr Field<U2, 16>	tAccS{};	// Seconds Part of the Time Accuracy (s)
+	static constexpr Field<U4, 20>	tAccNs{};	// Nanoseconds Part of the Time Accuracy (ns)
+};
+
+struct UBX::MGA::INI::GNSS_TIME{	// Initial GNSS Time
+	static const U1 type = 0x11u;
+	static const U2 payloadLen = 24u;
+
+	static constexpr Field<X1, 2>	ref{};		// Time Reference, as UTC_TIME
+	static constexpr Field<U1, 3>	gnssId{};	// GNSS Identifier
+	static constexpr Field<U2, 6>	week{};		// GNSS Week Number
+	static constexpr Field<U4, 8>	tow{};		// GNSS Time of Week (s)
+	static constexpr Field<U4, 12>	ns{};		// Nanoseconds (0..999999999)
+	static constexpr Field<U2, 16>	tAccS{};	// Seconds Part of the Time Accuracy (s)
+	static constexpr Field<U4, 20>	tAccNs{};	// Nanoseconds Part of the Time Accuracy (ns)
+};
+
+struct UBX::MGA::INI::CLKD{	// Initial Clock Drift
+	static const U1 type = 0x20u;
+	static const U2 payloadLen = 12u;
+
+	static constexpr Field<I4, 4>	clkD{};		// Clock Drift (ns/s)
+	static constexpr Field<U4, 8>	clkDAcc{};	// Clock Drift Accuracy (ns/s)
+};
+
+struct UBX::MGA::INI::FREQ{	// Initial Frequency of an External Reference
+	static const U1 type = 0x21u;
+	static const U2 payloadLen = 12u;
+
+	static constexpr Field<X1, 3>	flags{};	// Source (EXTINT0, EXTINT1) and Falling Edge
+	static constexpr Field<I4, 4>	freq{};		// Frequency (1e-2 Hz)
+	static constexpr Field<U4, 8>	freqAcc{};	// Frequency Accuracy (ppb)
+};
+
+struct UBX::MGA::INI::EOP{	// Earth Orientation Parameters
+	static const U1 type = 0x30u;
+	static const U2 payloadLen = 72u;
+
+	static constexpr Field<U2, 4>	d2kRef{};	// Reference Time, Days since 2000-01-01
+	static constexpr Field<U2, 6>	d2kMax{};	// Expiration Time, Days since 2000-01-01
+	static constexpr Field<I4, 8>	xpP0{};		// X-Axis Polar Motion Bias (2^-30 arcsec)
+	static constexpr Field<I4, 12>	xpP1{};		// X-Axis Polar Motion Drift (2^-30 arcsec/day)
+	static constexpr Field<I4, 16>	ypP0{};		// Y-Axis Polar Motion Bias (2^-30 arcsec)
+	static constexpr Field<I4, 20>	ypP1{};		// Y-Axis Polar Motion Drift (2^-30 arcsec/day)
+	static constexpr Field<I4, 24>	dUT1{};		// UT1 - UTC Bias (2^-25 s)
+	static constexpr Field<I4, 28>	ddUT1{};	// UT1 - UTC Drift (2^-30 s/day)
+};
+
+/**
+ * @brief QZSS Assistance (UBX-MGA-QZSS).
+ */
 class UBX::MGA::QZSS : public UBX::MGA{
 public:
-	QZSS(const vect & ubx);
+	static const U1 ID = 0x05u;
+	static const U2 payloadLen = 12u;	// Of the shortest type.
+
+	enum class Type : U1{
+		EPH		= 0x01u,	// 68 bytes
+		ALM		= 0x02u,	// 36 bytes
+		HEALTH	= 0x04u		// 12 bytes
+	};
+
+	static constexpr Field<U1, 0>	type{};		// See Type
+	static constexpr Field<U1, 1>	version{};	// Message Version (0x00)
+	static constexpr Field<U1, 2>	svId{};		// Satellite Identifier, of EPH and ALM
+
+	QZSS(const uint8_t * first, const uint8_t * last) : MGA(ID, payloadLen, first, last) {}
+
+	static constexpr U2 length(Type t){
+		switch(t){
+		case Type::EPH:		return 68u;
+		case Type::ALM:		return 36u;
+		case Type::HEALTH:	return 12u;
+		default:			return 0u;
+		}
+	}
 };
 
 
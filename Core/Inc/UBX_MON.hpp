@@ -38,81 +38,380 @@ public:
 	class TXBUF;
 	class VER;
 
+	static const U1 classID = 0x0Au;
+
+protected:
+	MON(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, len, first, last) {}
 };
 
+/**
+ * @brief Data Batching Buffer Status (UBX-MON-BATCH).
+ */
 class UBX::MON::BATCH : public UBX::MON{
 public:
-	BATCH(const vect & ubx);
+	static const U1 ID = 0x32u;
+	static const U2 payloadLen = 12u;
+
+	static constexpr Field<U1, 0>	version{};			// Message Version (0x00)
+	static constexpr Field<U2, 4>	fillLevel{};		// Epochs Buffered
+	static constexpr Field<U2, 6>	dropsAll{};			// Epochs Dropped since Batching Started
+	static constexpr Field<U2, 8>	dropsSinceMon{};	// Epochs Dropped since the last MON-BATCH
+	static constexpr Field<U2, 10>	nextMsgCnt{};		// Next Message Count to be Retrieved
+
+	BATCH(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Communication Port Information (UBX-MON-COMMS), with the traffic of each port.
+ */
 class UBX::MON::COMMS : public UBX::MON{
 public:
-	COMMS(const vect & ubx);
+	static const U1 ID = 0x36u;
+	static const U2 payloadLen = 8u;	// Without any ports.
+	static const U2 portLen = 40u;		// Per port.
+
+	static constexpr Field<U1, 0>		version{};	// Message Version (0x00)
+	static constexpr Field<U1, 1>		nPorts{};	// Number of Ports
+	static constexpr Field<X1, 2>		txErrors{};	// TX Error Flags: Memory Limit, Buffer Limit
+	static constexpr Array<U1, 4, 4>	protIds{};	// Protocol Identifier of each msgs counter (0 UBX, 1 NMEA, 2 RTCM2, 5 RTCM3,
+													// 6 SPARTN, 0xFF None)
+
+	struct Port{	// Offsets within each port's block.
+		static constexpr Field<U2, 0>		portId{};		// Port Identifier
+		static constexpr Field<U2, 2>		txPending{};	// Bytes Pending in the TX Buffer
+		static constexpr Field<U4, 4>		txBytes{};		// Bytes Sent
+		static constexpr Field<U1, 8>		txUsage{};		// TX Buffer Usage, over the last sysmon period (%)
+		static constexpr Field<U1, 9>		txPeakUsage{};	// Peak TX Buffer Usage (%)
+		static constexpr Field<U2, 10>		rxPending{};	// Bytes Pending in the RX Buffer
+		static constexpr Field<U4, 12>		rxBytes{};		// Bytes Received
+		static constexpr Field<U1, 16>		rxUsage{};		// RX Buffer Usage, over the last sysmon period (%)
+		static constexpr Field<U1, 17>		rxPeakUsage{};	// Peak RX Buffer Usage (%)
+		static constexpr Field<U2, 18>		overrunErrs{};	// Overrun Errors
+		static constexpr Array<U2, 20, 4>	msgs{};			// Messages Parsed, per protIds
+		static constexpr Field<U4, 36>		skipped{};		// Bytes Skipped
+	};
+
+	COMMS(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline U1 count() const { return (get(nPorts) < blocks(payloadLen, portLen)) ? get(nPorts) : blocks(payloadLen, portLen); }
+
+	template<typename T, size_t Offset>
+	inline T port(U1 i, Field<T, Offset> f) const { return block(payloadLen, portLen, i, f); }	// i < count()
+
+	template<typename T, size_t Offset, size_t N>
+	inline T port(U1 i, Array<T, Offset, N> a, size_t j) const { return block(payloadLen, portLen, i, a, j); }	// j < N
 };
 
+/**
+ * @brief Information Message Major GNSS Selection (UBX-MON-GNSS). Each GNSS is a bit: 0 GPS, 1 GLONASS, 2 BeiDou,
+ * 3 Galileo.
+ */
 class UBX::MON::GNSS : public UBX::MON{
 public:
-	GNSS(const vect & ubx);
+	static const U1 ID = 0x28u;
+	static const U2 payloadLen = 8u;
+
+	static constexpr Field<U1, 0>	version{};		// Message Version (0x00)
+	static constexpr Field<X1, 1>	supported{};	// GNSS Supported
+	static constexpr Field<X1, 2>	defaultGnss{};	// Default GNSS Selection
+	static constexpr Field<X1, 3>	enabled{};		// Current GNSS Selection
+	static constexpr Field<U1, 4>	simultaneous{};	// Maximum Number of Concurrent Major GNSS
+
+	GNSS(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Hardware Status (UBX-MON-HW). Deprecated in favour of MON-HW3 and MON-RF.
+ */
 class UBX::MON::HW : public UBX::MON{
 public:
-	HW(const vect & ubx);
+	static const U1 ID = 0x09u;
+	static const U2 payloadLen = 60u;
+
+	enum class AntennaStatus : U1{
+		INIT	= 0u,
+		DONTKNOW= 1u,
+		OK		= 2u,
+		SHORT	= 3u,
+		OPEN	= 4u
+	};
+
+	static constexpr Field<X4, 0>		pinSel{};		// Mask of Pins set as Peripheral / PIO
+	static constexpr Field<X4, 4>		pinBank{};		// Mask of Pins set as Bank A / B
+	static constexpr Field<X4, 8>		pinDir{};		// Mask of Pins set as Input / Output
+	static constexpr Field<X4, 12>		pinVal{};		// Mask of Pins Value Low / High
+	static constexpr Field<U2, 16>		noisePerMS{};	// Noise Level
+	static constexpr Field<U2, 18>		agcCnt{};		// AGC Monitor (0..8191)
+	static constexpr Field<U1, 20>		aStatus{};		// Antenna Supervisor State, see AntennaStatus
+	static constexpr Field<U1, 21>		aPower{};		// Antenna Power Status (0 Off, 1 On, 2 Unknown)
+	static constexpr Field<X1, 22>		flags{};		// RTC Calibrated, Safe Boot, Jamming State, Crystal Absent
+	static constexpr Field<X4, 24>		usedMask{};		// Mask of Pins Used by the Virtual Pin Manager
+	static constexpr Array<U1, 28, 17>	VP{};			// Virtual Pin Mapping, per physical pin
+	static constexpr Field<U1, 45>		jamInd{};		// CW Jamming Indicator (0 None .. 255 Strong)
+	static constexpr Field<X4, 48>		pinIrq{};		// Mask of Pins Value using the PIO IRQ
+	static constexpr Field<X4, 52>		pullH{};		// Mask of Pins with Pull-High Resistors
+	static constexpr Field<X4, 56>		pullL{};		// Mask of Pins with Pull-Low Resistors
+
+	HW(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline U1 jammingState() const { return (get(flags) >> 2) & 0x03u; }	// 0 Unknown, 1 OK, 2 Warning, 3 Critical
 };
 
+/**
+ * @brief Extended Hardware Status (UBX-MON-HW2). Deprecated in favour of MON-HW3 and MON-RF.
+ */
 class UBX::MON::HW2 : public UBX::MON{
 public:
-	HW2(const vect & ubx);
+	static const U1 ID = 0x0Bu;
+	static const U2 payloadLen = 28u;
+
+	static constexpr Field<I1, 0>	ofsI{};			// Imbalance of the I-Part of the Complex Signal (-128..127)
+	static constexpr Field<U1, 1>	magI{};			// Magnitude of the I-Part of the Complex Signal (0..255)
+	static constexpr Field<I1, 2>	ofsQ{};			// Imbalance of the Q-Part of the Complex Signal (-128..127)
+	static constexpr Field<U1, 3>	magQ{};			// Magnitude of the Q-Part of the Complex Signal (0..255)
+	static constexpr Field<U1, 4>	cfgSource{};	// Source of the Low-Level Configuration ('r' ROM, 'o' OTP, 'p' Pins, 'f' Flash)
+	static constexpr Field<U4, 8>	lowLevCfg{};	// Low-Level Configuration
+	static constexpr Field<U4, 20>	postStatus{};	// Power-On Self-Test Status Word
+
+	HW2(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief I/O Pin Status (UBX-MON-HW3), with the state of each pin.
+ */
 class UBX::MON::HW3 : public UBX::MON{
 public:
-	HW3(const vect & ubx);
+	static const U1 ID = 0x37u;
+	static const U2 payloadLen = 22u;	// Without any pins.
+	static const U2 pinLen = 6u;		// Per pin.
+	static const U2 hwVersionLen = 10u;
+
+	static constexpr Field<U1, 0>	version{};	// Message Version (0x00)
+	static constexpr Field<U1, 1>	nPins{};	// Number of Pins
+	static constexpr Field<X1, 2>	flags{};	// RTC Calibrated, Safe Boot, Crystal Absent
+
+	struct Pin{	// Offsets within each pin's block.
+		static constexpr Field<U2, 0>	pinId{};	// Pin Identifier
+		static constexpr Field<X2, 2>	pinMask{};	// Peripheral / PIO, Bank, Direction, Value, VP Manager, IRQ, Pulls
+		static constexpr Field<U1, 4>	VP{};		// Virtual Pin
+	};
+
+	HW3(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline StaticString hwVersion() const { return text(3u, hwVersionLen); }	// Hardware Version
+
+	inline U1 count() const { return (get(nPins) < blocks(payloadLen, pinLen)) ? get(nPins) : blocks(payloadLen, pinLen); }
+
+	template<typename T, size_t Offset>
+	inline T pin(U1 i, Field<T, Offset> f) const { return block(payloadLen, pinLen, i, f); }	// i < count()
 };
 
+/**
+ * @brief I/O Subsystem Status (UBX-MON-IO), with the traffic of each port. Deprecated in favour of MON-COMMS.
+ */
 class UBX::MON::IO : public UBX::MON{
 public:
-	IO(const vect & ubx);
+	static const U1 ID = 0x02u;
+	static const U2 payloadLen = 0u;	// Without any ports.
+	static const U2 portLen = 20u;		// Per port.
+
+	struct Port{	// Offsets within each port's block.
+		static constexpr Field<U4, 0>	rxBytes{};		// Bytes Received
+		static constexpr Field<U4, 4>	txBytes{};		// Bytes Sent
+		static constexpr Field<U2, 8>	parityErrs{};	// Parity Errors
+		static constexpr Field<U2, 10>	framingErrs{};	// Framing Errors
+		static constexpr Field<U2, 12>	overrunErrs{};	// Overrun Errors
+		static constexpr Field<U2, 14>	breakCond{};	// Break Conditions
+	};
+
+	IO(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline U1 count() const { return blocks(payloadLen, portLen); }
+
+	template<typename T, size_t Offset>
+	inline T port(U1 i, Field<T, Offset> f) const { return block(payloadLen, portLen, i, f); }	// i < count()
 };
 
+/**
+ * @brief Message Parse and Process Status (UBX-MON-MSGPP), per port and protocol. Deprecated in favour of MON-COMMS.
+ */
 class UBX::MON::MSGPP : public UBX::MON{
 public:
-	MSGPP(const vect & ubx);
+	static const U1 ID = 0x06u;
+	static const U2 payloadLen = 120u;
+	static const U1 ports = 6u;
+	static const U1 protocols = 8u;
+
+	static constexpr Array<U2, 0, 48>	msg{};		// Messages Parsed, protocols per port, port-major
+	static constexpr Array<U4, 96, 6>	skipped{};	// Bytes Skipped, per port
+
+	MSGPP(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline U2 parsed(U1 port, U1 protocol) const { return get(msg, port * protocols + protocol); }	// port < ports, protocol < protocols
 };
 
+/**
+ * @brief Installed Patches (UBX-MON-PATCH).
+ */
 class UBX::MON::PATCH : public UBX::MON{
 public:
-	PATCH(const vect & ubx);
+	static const U1 ID = 0x27u;
+	static const U2 payloadLen = 4u;	// Without any patches.
+	static const U2 patchLen = 16u;		// Per patch.
+
+	static constexpr Field<U2, 0>	version{};	// Message Version (0x0001)
+	static constexpr Field<U2, 2>	nEntries{};	// Number of Patches
+
+	struct Patch{	// Offsets within each patch's block.
+		static constexpr Field<X4, 0>	patchInfo{};		// Activated, Location (eFuse, ROM, BBR, File System)
+		static constexpr Field<U4, 4>	comparatorNumber{};	// Comparator Number
+		static constexpr Field<U4, 8>	patchAddress{};		// Patch Address
+		static constexpr Field<U4, 12>	patchData{};		// Patch Data
+	};
+
+	PATCH(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline U2 count() const { return (get(nEntries) < blocks(payloadLen, patchLen)) ? get(nEntries) : blocks(payloadLen, patchLen); }
+
+	template<typename T, size_t Offset>
+	inline T patch(U2 i, Field<T, Offset> f) const { return block(payloadLen, patchLen, i, f); }	// i < count()
 };
 
+/**
+ * @brief RF Information (UBX-MON-RF), with the state of each RF block.
+ */
 class UBX::MON::RF : public UBX::MON{
 public:
-	RF(const vect & ubx);
+	static const U1 ID = 0x38u;
+	static const U2 payloadLen = 4u;	// Without any RF blocks.
+	static const U2 blockLen = 24u;		// Per RF block.
+
+	static constexpr Field<U1, 0>	version{};	// Message Version (0x00)
+	static constexpr Field<U1, 1>	nBlocks{};	// Number of RF Blocks
+
+	struct Block{	// Offsets within each RF block.
+		static constexpr Field<U1, 0>	blockId{};		// RF Block Identifier (0 L1, 1 L2 or L5)
+		static constexpr Field<X1, 1>	flags{};		// Jamming State (0 Unknown, 1 OK, 2 Warning, 3 Critical)
+		static constexpr Field<U1, 2>	antStatus{};	// Antenna Supervisor State, see HW::AntennaStatus
+		static constexpr Field<U1, 3>	antPower{};		// Antenna Power Status (0 Off, 1 On, 2 Unknown)
+		static constexpr Field<U4, 4>	postStatus{};	// Power-On Self-Test Status Word
+		static constexpr Field<U2, 12>	noisePerMS{};	// Noise Level
+		static constexpr Field<U2, 14>	agcCnt{};		// AGC Monitor (0..8191)
+		static constexpr Field<U1, 16>	jamInd{};		// CW Jamming Indicator (0 None .. 255 Strong)
+		static constexpr Field<I1, 17>	ofsI{};			// Imbalance of the I-Part of the Complex Signal
+		static constexpr Field<U1, 18>	magI{};			// Magnitude of the I-Part of the Complex Signal
+		static constexpr Field<I1, 19>	ofsQ{};			// Imbalance of the Q-Part of the Complex Signal
+		static constexpr Field<U1, 20>	magQ{};			// Magnitude of the Q-Part of the Complex Signal
+	};
+
+	RF(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline U1 count() const { return (get(nBlocks) < blocks(payloadLen, blockLen)) ? get(nBlocks) : blocks(payloadLen, blockLen); }
+
+	template<typename T, size_t Offset>
+	inline T rf(U1 i, Field<T, Offset> f) const { return block(payloadLen, blockLen, i, f); }	// i < count()
+
+	inline U1 jammingState(U1 i) const { return rf(i, Block::flags) & 0x03u; }
 };
 
+/**
+ * @brief Receiver Buffer Status (UBX-MON-RXBUF), per port. Deprecated in favour of MON-COMMS.
+ */
 class UBX::MON::RXBUF : public UBX::MON{
 public:
-	RXBUF(const vect & ubx);
+	static const U1 ID = 0x07u;
+	static const U2 payloadLen = 24u;
+
+	static constexpr Array<U2, 0, 6>	pending{};		// Bytes Pending in the RX Buffer
+	static constexpr Array<U1, 12, 6>	usage{};		// RX Buffer Usage (%)
+	static constexpr Array<U1, 18, 6>	peakUsage{};	// Peak RX Buffer Usage (%)
+
+	RXBUF(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Receiver Status Information (UBX-MON-RXR). Output when the receiver awakes.
+ */
 class UBX::MON::RXR : public UBX::MON{
 public:
-	RXR(const vect & ubx);
+	static const U1 ID = 0x21u;
+	static const U2 payloadLen = 1u;
+
+	static constexpr Field<X1, 0>	flags{};	// Bit 0: Awake (not in Backup Mode)
+
+	RXR(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline bool awake() const { return get(flags) & 0x01u; }
 };
 
+/**
+ * @brief Signal Characteristics (UBX-MON-SPAN), with a 256-bin spectrum of each RF block.
+ */
 class UBX::MON::SPAN : public UBX::MON{
 public:
-	SPAN(const vect & ubx);
+	static const U1 ID = 0x31u;
+	static const U2 payloadLen = 4u;	// Without any RF blocks.
+	static const U2 blockLen = 272u;	// Per RF block.
+	static const U2 bins = 256u;
+
+	static constexpr Field<U1, 0>	version{};		// Message Version (0x00)
+	static constexpr Field<U1, 1>	numRfBlocks{};	// Number of RF Blocks
+
+	struct Block{	// Offsets within each RF block.
+		static constexpr Array<U1, 0, 256>	spectrum{};	// Spectrum Data (dB / 4)
+		static constexpr Field<U4, 256>		span{};		// Spectrum Span (Hz)
+		static constexpr Field<U4, 260>		res{};		// Resolution (Hz)
+		static constexpr Field<U4, 264>		center{};	// Center Frequency (Hz)
+		static constexpr Field<U1, 268>		pga{};		// Programmable Gain Amplifier (dB)
+	};
+
+	SPAN(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline U1 count() const { return (get(numRfBlocks) < blocks(payloadLen, blockLen)) ? get(numRfBlocks) : blocks(payloadLen, blockLen); }
+
+	template<typename T, size_t Offset>
+	inline T rf(U1 i, Field<T, Offset> f) const { return block(payloadLen, blockLen, i, f); }	// i < count()
+
+	inline U1 spectrum(U1 i, U2 bin) const { return block(payloadLen, blockLen, i, Block::spectrum, bin); }	// bin < bins
 };
 
+/**
+ * @brief Transmitter Buffer Status (UBX-MON-TXBUF), per port. Deprecated in favour of MON-COMMS.
+ */
 class UBX::MON::TXBUF : public UBX::MON{
 public:
-	TXBUF(const vect & ubx);
+	static const U1 ID = 0x08u;
+	static const U2 payloadLen = 28u;
+
+	static constexpr Array<U2, 0, 6>	pending{};		// Bytes Pending in the TX Buffer
+	static constexpr Array<U1, 12, 6>	usage{};		// TX Buffer Usage (%)
+	static constexpr Array<U1, 18, 6>	peakUsage{};	// Peak TX Buffer Usage (%)
+	static constexpr Field<U1, 24>		tUsage{};		// Total TX Buffer Usage (%)
+	static constexpr Field<U1, 25>		tPeakusage{};	// Peak Total TX Buffer Usage (%)
+	static constexpr Field<X1, 26>		errors{};		// Limit, Memory Allocation and Buffer Allocation Errors
+
+	TXBUF(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Receiver and Software Version (UBX-MON-VER).
+ * 
+ * Each version string is a NUL-padded field of fixed width, viewed without copying. The frame must outlive the view.
+ */
 class UBX::MON::VER : public UBX::MON{
 public:
-	VER(const vect & ubx);
+	static const U1 ID = 0x04u;
+	static const U2 payloadLen = 40u;	// Without any extensions.
+	static const U2 swVersionLen = 30u;
+	static const U2 hwVersionLen = 10u;
+	static const U2 extensionLen = 30u;	// Per extension.
+
+	VER(const uint8_t * first, const uint8_t * last) : MON(ID, payloadLen, first, last) {}
+
+	inline StaticString swVersion() const { return text(0u, swVersionLen); }			// Software Version
+	inline StaticString hwVersion() const { return text(swVersionLen, hwVersionLen); }	// Hardware Version
+	inline U1 extensions() const { return blocks(payloadLen, extensionLen); }
+	inline StaticString extension(U1 i) const { return text(payloadLen + extensionLen * i, extensionLen); }	// i < extensions(), e.g. "PROTVER=32.01"
 };
 
 
@@ -20,6 +20,8 @@
 
 #include "UBX.hpp"
 
+#include <time.h>
+
 class UBX::NAV : public UBX{
 public:
 	class CLOCK;
@@ -38,66 +40,356 @@ public:
 	class TIME;
 	class VEL;
 
+	static const U1 classID = 0x01u;
+
+protected:
+	NAV(U1 msgID, U2 len) : UBX(classID, msgID, len) {}
+	NAV(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, len, first, last) {}
 };
 
+/**
+ * @brief Clock Solution (UBX-NAV-CLOCK).
+ */
 class UBX::NAV::CLOCK : public UBX::NAV{
 public:
-	CLOCK(const vect & ubx);
+	static const U1 ID = 0x22u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<U4, 0>	iTOW{};	// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<I4, 4>	clkB{};	// Clock Bias (ns)
+	static constexpr Field<I4, 8>	clkD{};	// Clock Drift (ns/s)
+	static constexpr Field<U4, 12>	tAcc{};	// Time Accuracy Estimate (ns)
+	static constexpr Field<U4, 16>	fAcc{};	// Frequency Accuracy Estimate (ps/s)
+
+	CLOCK(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Covariance Matrices of the Position and Velocity Solutions (UBX-NAV-COV). Both are in the NED frame.
+ */
 class UBX::NAV::COV : public UBX::NAV{
 public:
-	COV(const vect & ubx);
+	static const U1 ID = 0x36u;
+	static const U2 payloadLen = 64u;
+
+	static constexpr Field<U4, 0>	iTOW{};			// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U1, 4>	version{};		// Message Version (0x00)
+	static constexpr Field<U1, 5>	posCovValid{};	// Position Covariance Matrix Valid
+	static constexpr Field<U1, 6>	velCovValid{};	// Velocity Covariance Matrix Valid
+	static constexpr Field<R4, 16>	posCovNN{};		// Position Covariance (m^2)
+	static constexpr Field<R4, 20>	posCovNE{};
+	static constexpr Field<R4, 24>	posCovND{};
+	static constexpr Field<R4, 28>	posCovEE{};
+	static constexpr Field<R4, 32>	posCovED{};
+	static constexpr Field<R4, 36>	posCovDD{};
+	static constexpr Field<R4, 40>	velCovNN{};		// Velocity Covariance (m^2/s^2)
+	static constexpr Field<R4, 44>	velCovNE{};
+	static constexpr Field<R4, 48>	velCovND{};
+	static constexpr Field<R4, 52>	velCovEE{};
+	static constexpr Field<R4, 56>	velCovED{};
+	static constexpr Field<R4, 60>	velCovDD{};
+
+	COV(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Dilution of Precision (UBX-NAV-DOP). All DOP values are scaled by 0.01.
+ */
 class UBX::NAV::DOP : public UBX::NAV{
 public:
-	DOP(const vect & ubx);
+	static const U1 ID = 0x04u;
+	static const U2 payloadLen = 18u;
+
+	static constexpr Field<U4, 0>	iTOW{};	// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U2, 4>	gDOP{};	// Geometric DOP
+	static constexpr Field<U2, 6>	pDOP{};	// Position DOP
+	static constexpr Field<U2, 8>	tDOP{};	// Time DOP
+	static constexpr Field<U2, 10>	vDOP{};	// Vertical DOP
+	static constexpr Field<U2, 12>	hDOP{};	// Horizontal DOP
+	static constexpr Field<U2, 14>	nDOP{};	// Northing DOP
+	static constexpr Field<U2, 16>	eDOP{};	// Easting DOP
+
+	DOP(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief End of Epoch (UBX-NAV-EOE). Sent once all enabled NAV messages of the epoch have been sent.
+ */
 class UBX::NAV::EOE : public UBX::NAV{
 public:
-	EOE(const vect & ubx);
+	static const U1 ID = 0x61u;
+	static const U2 payloadLen = 4u;
+
+	static constexpr Field<U4, 0>	iTOW{};	// GPS Time of Week of the Navigation Epoch (ms)
+
+	EOE(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Geofencing Status (UBX-NAV-GEOFENCE), with the state of each configured fence.
+ */
 class UBX::NAV::GEOFENCE : public UBX::NAV{
 public:
-	GEOFENCE(const vect & ubx);
+	static const U1 ID = 0x39u;
+	static const U2 payloadLen = 8u;	// Without any fences.
+	static const U2 fenceLen = 2u;		// Per fence.
+
+	enum class State : U1{
+		UNKNOWN	= 0u,
+		INSIDE	= 1u,
+		OUTSIDE	= 2u
+	};
+
+	static constexpr Field<U4, 0>	iTOW{};			// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U1, 4>	version{};		// Message Version (0x00)
+	static constexpr Field<U1, 5>	status{};		// Geofencing Status (0 Not Available, 1 Active)
+	static constexpr Field<U1, 6>	numFences{};	// Number of Geofences
+	static constexpr Field<U1, 7>	combState{};	// Combined State of all Geofences, see State
+
+	struct Fence{	// Offsets within each fence's block.
+		static constexpr Field<U1, 0>	state{};	// See State
+		static constexpr Field<U1, 1>	id{};		// Geofence Identifier
+	};
+
+	GEOFENCE(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
+
+	inline U1 count() const { return (get(numFences) < blocks(payloadLen, fenceLen)) ? get(numFences) : blocks(payloadLen, fenceLen); }
+
+	template<typename T, size_t Offset>
+	inline T fence(U1 i, Field<T, Offset> f) const { return block(payloadLen, fenceLen, i, f); }	// i < count()
 };
 
+/**
+ * @brief Odometer Solution (UBX-NAV-ODO).
+ */
 class UBX::NAV::ODO : public UBX::NAV{
 public:
-	ODO(const vect & ubx);
+	static const U1 ID = 0x09u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<U1, 0>	version{};			// Message Version (0x00)
+	static constexpr Field<U4, 4>	iTOW{};				// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U4, 8>	distance{};			// Ground Distance since the last Reset (m)
+	static constexpr Field<U4, 12>	totalDistance{};	// Total Cumulative Ground Distance (m)
+	static constexpr Field<U4, 16>	distanceStd{};		// Ground Distance Accuracy, 1-sigma (m)
+
+	ODO(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief GNSS Orbit Database Information (UBX-NAV-ORB), with the ephemeris and almanac state of each satellite.
+ */
 class UBX::NAV::ORB : public UBX::NAV{
 public:
-	ORB(const vect & ubx);
+	static const U1 ID = 0x34u;
+	static const U2 payloadLen = 8u;	// Without any satellites.
+	static const U2 svLen = 6u;			// Per satellite.
+
+	static constexpr Field<U4, 0>	iTOW{};		// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U1, 4>	version{};	// Message Version (0x01)
+	static constexpr Field<U1, 5>	numSv{};	// Number of Satellites
+
+	struct Sv{	// Offsets within each satellite's block.
+		static constexpr Field<U1, 0>	gnssId{};	// GNSS Identifier
+		static constexpr Field<U1, 1>	svId{};		// Satellite Identifier
+		static constexpr Field<X1, 2>	svFlag{};	// Health and Visibility
+		static constexpr Field<X1, 3>	eph{};		// Ephemeris Usability and Source
+		static constexpr Field<X1, 4>	alm{};		// Almanac Usability and Source
+		static constexpr Field<X1, 5>	otherOrb{};	// Other Orbit Data Usability and Type
+	};
+
+	ORB(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
+
+	inline U1 count() const { return (get(numSv) < blocks(payloadLen, svLen)) ? get(numSv) : blocks(payloadLen, svLen); }
+
+	template<typename T, size_t Offset>
+	inline T sv(U1 i, Field<T, Offset> f) const { return block(payloadLen, svLen, i, f); }	// i < count()
+
+	inline U1 ephUsability(U1 i) const { return sv(i, Sv::eph) & 0x1Fu; }	// 0 Unknown, 1..30 in 15 minute steps, 31 Unusable
+	inline U1 almUsability(U1 i) const { return sv(i, Sv::alm) & 0x1Fu; }	// 0 Unknown, 1..30 in days, 31 Unusable
 };
 
+/**
+ * @brief Navigation Position Velocity Time Solution (UBX-NAV-PVT).
+ * 
+ * A view over the payload of a received frame. Fields are decoded upon access and nothing is copied, so the frame
+ * must outlive the view.
+ */
 class UBX::NAV::PVT : public UBX::NAV{
 public:
-	PVT(const vect & ubx);
+	static const U1 ID = 0x07u;
+	static const U2 payloadLen = 92u;
+
+	enum class FixType : U1{
+		NO_FIX			= 0u,
+		DEAD_RECKONING	= 1u,
+		FIX_2D			= 2u,
+		FIX_3D			= 3u,
+		GNSS_DR			= 4u,	// GNSS and Dead Reckoning Combined
+		TIME_ONLY		= 5u
+	};
+
+	/* Time */
+	static constexpr Field<U4, 0>	iTOW{};			// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U2, 4>	year{};			// UTC Year
+	static constexpr Field<U1, 6>	month{};		// UTC Month (1..12)
+	static constexpr Field<U1, 7>	day{};			// UTC Day of Month (1..31)
+	static constexpr Field<U1, 8>	hour{};			// UTC Hour (0..23)
+	static constexpr Field<U1, 9>	min{};			// UTC Minute (0..59)
+	static constexpr Field<U1, 10>	sec{};			// UTC Second (0..60)
+	static constexpr Field<X1, 11>	validFlags{};	// Validity Flags (see validDate() etc.)
+	static constexpr Field<U4, 12>	tAcc{};			// Time Accuracy Estimate (ns)
+	static constexpr Field<I4, 16>	nano{};			// Fraction of Second (ns, -1e9..1e9)
+
+	/* Fix */
+	static constexpr Field<E1, 20>	fixType{};		// See FixType
+	static constexpr Field<X1, 21>	flags{};		// Fix Status Flags
+	static constexpr Field<X1, 22>	flags2{};		// Additional Flags
+	static constexpr Field<U1, 23>	numSV{};		// Satellites used in the Solution
+
+	/* Position */
+	static constexpr Field<I4, 24>	lon{};			// Longitude (1e-7 deg)
+	static constexpr Field<I4, 28>	lat{};			// Latitude (1e-7 deg)
+	static constexpr Field<I4, 32>	height{};		// Height above Ellipsoid (mm)
+	static constexpr Field<I4, 36>	hMSL{};			// Height above Mean Sea Level (mm)
+	static constexpr Field<U4, 40>	hAcc{};			// Horizontal Accuracy Estimate (mm)
+	static constexpr Field<U4, 44>	vAcc{};			// Vertical Accuracy Estimate (mm)
+
+	/* Velocity */
+	static constexpr Field<I4, 48>	velN{};			// NED North Velocity (mm/s)
+	static constexpr Field<I4, 52>	velE{};			// NED East Velocity (mm/s)
+	static constexpr Field<I4, 56>	velD{};			// NED Down Velocity (mm/s)
+	static constexpr Field<I4, 60>	gSpeed{};		// Ground Speed (mm/s)
+	static constexpr Field<I4, 64>	headMot{};		// Heading of Motion (1e-5 deg)
+	static constexpr Field<U4, 68>	sAcc{};			// Speed Accuracy Estimate (mm/s)
+	static constexpr Field<U4, 72>	headAcc{};		// Heading Accuracy Estimate (1e-5 deg)
+
+	static constexpr Field<U2, 76>	pDOP{};			// Position DOP (0.01)
+	static constexpr Field<X1, 78>	flags3{};		// Additional Flags
+	static constexpr Field<I4, 84>	headVeh{};		// Heading of Vehicle (1e-5 deg)
+	static constexpr Field<I2, 88>	magDec{};		// Magnetic Declination (1e-2 deg)
+	static constexpr Field<U2, 90>	magAcc{};		// Magnetic Declination Accuracy (1e-2 deg)
+
+	PVT(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}	// The complete frame, from sync1 to ckB.
+
+	inline bool validDate() const		{ return get(validFlags) & 0x01u; }
+	inline bool validTime() const		{ return get(validFlags) & 0x02u; }
+	inline bool fullyResolved() const	{ return get(validFlags) & 0x04u; }
+	inline bool gnssFixOK() const		{ return get(flags) & 0x01u; }		// Fix within DOP and accuracy masks.
+	inline bool invalidLlh() const		{ return get(flags3) & 0x01u; }		// lon, lat, height and hMSL are invalid.
+
+	time_t epoch() const;		// UNIX Epoch Time (s)
+	int64_t epochMs() const;	// UNIX Epoch Time, with nano (ms)
 };
 
+/**
+ * @brief Reset Odometer (UBX-NAV-RESETODO). A command without payload.
+ */
 class UBX::NAV::RESET_ODO : public UBX::NAV{
 public:
-	RESET_ODO(const vect & ubx);
+	static const U1 ID = 0x10u;
+	static const U2 payloadLen = 0u;
+
+	RESET_ODO(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Satellite Information (UBX-NAV-SAT), with the signal and use of each satellite tracked.
+ */
 class UBX::NAV::SAT : public UBX::NAV{
 public:
-	SAT(const vect & ubx);
+	static const U1 ID = 0x35u;
+	static const U2 payloadLen = 8u;	// Without any satellites.
+	static const U2 svLen = 12u;		// Per satellite.
+
+	static constexpr Field<U4, 0>	iTOW{};			// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U1, 4>	version{};		// Message Version (0x01)
+	static constexpr Field<U1, 5>	numSvs{};		// Number of Satellites
+
+	struct Sv{	// Offsets within each satellite's block.
+		static constexpr Field<U1, 0>	gnssId{};	// GNSS Identifier
+		static constexpr Field<U1, 1>	svId{};		// Satellite Identifier
+		static constexpr Field<U1, 2>	cno{};		// Carrier to Noise Ratio (dBHz)
+		static constexpr Field<I1, 3>	elev{};		// Elevation (deg, -90..90). Unknown if out of range.
+		static constexpr Field<I2, 4>	azim{};		// Azimuth (deg, 0..360). Unknown if elevation is out of range.
+		static constexpr Field<I2, 6>	prRes{};	// Pseudorange Residual (0.1 m)
+		static constexpr Field<X4, 8>	flags{};	// Quality, Use, Health and Orbit Source Flags
+	};
+
+	SAT(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
+
+	/**
+	 * @brief Satellites in the frame received. numSvs, if the frame is long enough to hold them all.
+	 */
+	inline U1 count() const { return (get(numSvs) < blocks(payloadLen, svLen)) ? get(numSvs) : blocks(payloadLen, svLen); }
+
+	template<typename T, size_t Offset>
+	inline T sv(U1 i, Field<T, Offset> f) const { return block(payloadLen, svLen, i, f); }	// i < count()
+
+	inline U1 qualityInd(U1 i) const	{ return sv(i, Sv::flags) & 0x07u; }		// 0 No Signal .. 4 Code Locked .. 7 Carrier Locked
+	inline bool svUsed(U1 i) const		{ return sv(i, Sv::flags) & 0x08u; }		// Used in the Solution.
+	inline U1 health(U1 i) const		{ return (sv(i, Sv::flags) >> 4) & 0x03u; }	// 0 Unknown, 1 Healthy, 2 Unhealthy
 };
 
+/**
+ * @brief Signal Information (UBX-NAV-SIG), with each signal tracked, several per satellite.
+ */
 class UBX::NAV::SIG : public UBX::NAV{
 public:
-	SIG(const vect & ubx);
+	static const U1 ID = 0x43u;
+	static const U2 payloadLen = 8u;	// Without any signals.
+	static const U2 sigLen = 16u;		// Per signal.
+
+	static constexpr Field<U4, 0>	iTOW{};			// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U1, 4>	version{};		// Message Version (0x00)
+	static constexpr Field<U1, 5>	numSigs{};		// Number of Signals
+
+	struct Sig{	// Offsets within each signal's block.
+		static constexpr Field<U1, 0>	gnssId{};		// GNSS Identifier
+		static constexpr Field<U1, 1>	svId{};			// Satellite Identifier
+		static constexpr Field<U1, 2>	sigId{};		// Signal Identifier
+		static constexpr Field<U1, 3>	freqId{};		// GLONASS Frequency Slot + 7
+		static constexpr Field<I2, 4>	prRes{};		// Pseudorange Residual (0.1 m)
+		static constexpr Field<U1, 6>	cno{};			// Carrier to Noise Ratio (dBHz)
+		static constexpr Field<U1, 7>	qualityInd{};	// 0 No Signal .. 4 Code Locked .. 7 Carrier Locked
+		static constexpr Field<U1, 8>	corrSource{};	// Correction Source
+		static constexpr Field<U1, 9>	ionoModel{};	// Ionospheric Model
+		static constexpr Field<X2, 10>	sigFlags{};		// Health and Use Flags
+	};
+
+	SIG(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
+
+	inline U1 count() const { return (get(numSigs) < blocks(payloadLen, sigLen)) ? get(numSigs) : blocks(payloadLen, sigLen); }
+
+	template<typename T, size_t Offset>
+	inline T sig(U1 i, Field<T, Offset> f) const { return block(payloadLen, sigLen, i, f); }	// i < count()
+
+	inline U1 health(U1 i) const	{ return sig(i, Sig::sigFlags) & 0x03u; }	// 0 Unknown, 1 Healthy, 2 Unhealthy
+	inline bool prUsed(U1 i) const	{ return sig(i, Sig::sigFlags) & 0x08u; }	// Pseudorange used in the Solution.
 };
 
+/**
+ * @brief Receiver Navigation Status (UBX-NAV-STATUS).
+ */
 class UBX::NAV::STATUS : public UBX::NAV{
 public:
-	STATUS(const vect & ubx);
+	static const U1 ID = 0x03u;
+	static const U2 payloadLen = 16u;
+
+	static constexpr Field<U4, 0>	iTOW{};			// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<E1, 4>	gpsFix{};		// See PVT::FixType
+	static constexpr Field<X1, 5>	flags{};		// Navigation Status Flags
+	static constexpr Field<X1, 6>	fixStat{};		// Fix Status Information
+	static constexpr Field<X1, 7>	flags2{};		// Further Information about Navigation Output
+	static constexpr Field<U4, 8>	ttff{};			// Time to First Fix (ms)
+	static constexpr Field<U4, 12>	msss{};			// Milliseconds since Startup or Reset (ms)
+
+	STATUS(const uint8_t * first, const uint8_t * last) : NAV(ID, payloadLen, first, last) {}
+
+	inline bool gpsFixOk() const	{ return get(flags) & 0x01u; }		// Fix within DOP and accuracy masks.
+	inline bool diffSoln() const	{ return get(flags) & 0x02u; }		// Differential corrections applied.
+	inline bool wknSet() const		{ return get(flags) & 0x04u; }		// Week number valid.
+	inline bool towSet() const		{ return get(flags) & 0x08u; }		// Time of week valid.
 };
 
 
@@ -106,17 +398,43 @@ public:
 	class ECEF;
 	class LLH;
 protected:
-	POS(const vect & ubx);
+	POS(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : NAV(msgID, len, first, last) {}
 };
 
+/**
+ * @brief Position Solution in ECEF (UBX-NAV-POSECEF).
+ */
 class UBX::NAV::POS::ECEF : public UBX::NAV::POS{
 public:
-	ECEF(const vect & ubx);
+	static const U1 ID = 0x01u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<U4, 0>	iTOW{};		// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<I4, 4>	ecefX{};	// ECEF X Coordinate (cm)
+	static constexpr Field<I4, 8>	ecefY{};	// ECEF Y Coordinate (cm)
+	static constexpr Field<I4, 12>	ecefZ{};	// ECEF Z Coordinate (cm)
+	static constexpr Field<U4, 16>	pAcc{};		// Position Accuracy Estimate (cm)
+
+	ECEF(const uint8_t * first, const uint8_t * last) : POS(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Geodetic Position Solution (UBX-NAV-POSLLH).
+ */
 class UBX::NAV::POS::LLH : public UBX::NAV::POS{
 public:
-	LLH(const vect & ubx);
+	static const U1 ID = 0x02u;
+	static const U2 payloadLen = 28u;
+
+	static constexpr Field<U4, 0>	iTOW{};		// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<I4, 4>	lon{};		// Longitude (1e-7 deg)
+	static constexpr Field<I4, 8>	lat{};		// Latitude (1e-7 deg)
+	static constexpr Field<I4, 12>	height{};	// Height above Ellipsoid (mm)
+	static constexpr Field<I4, 16>	hMSL{};		// Height above Mean Sea Level (mm)
+	static constexpr Field<U4, 20>	hAcc{};		// Horizontal Accuracy Estimate (mm)
+	static constexpr Field<U4, 24>	vAcc{};		// Vertical Accuracy Estimate (mm)
+
+	LLH(const uint8_t * first, const uint8_t * last) : POS(ID, payloadLen, first, last) {}
 };
 
 class UBX::NAV::TIME : public UBX::NAV{
@@ -129,42 +447,157 @@ public:
 	class QZSS;
 	class UTC;
 protected:
-	TIME(const vect & ubx);
+	TIME(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : NAV(msgID, len, first, last) {}
 };
 
+/**
+ * @brief BeiDou Time Solution (UBX-NAV-TIMEBDS).
+ */
 class UBX::NAV::TIME::BDS : public UBX::NAV::TIME{
 public:
-	BDS(const vect & ubx);
+	static const U1 ID = 0x24u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<U4, 0>	iTOW{};		// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U4, 4>	SOW{};		// BeiDou Time of Week, rounded (s)
+	static constexpr Field<I4, 8>	fSOW{};		// Fraction of Second, SOW + fSOW * 1e-9 (ns)
+	static constexpr Field<I2, 12>	week{};		// BeiDou Week Number
+	static constexpr Field<I1, 14>	leapS{};	// BeiDou Leap Seconds (s)
+	static constexpr Field<X1, 15>	valid{};	// Validity Flags: SOW, week and leapS
+	static constexpr Field<U4, 16>	tAcc{};		// Time Accuracy Estimate (ns)
+
+	BDS(const uint8_t * first, const uint8_t * last) : TIME(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Galileo Time Solution (UBX-NAV-TIMEGAL).
+ */
 class UBX::NAV::TIME::GAL : public UBX::NAV::TIME{
 public:
-	GAL(const vect & ubx);
+	static const U1 ID = 0x25u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<U4, 0>	iTOW{};		// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U4, 4>	galTow{};	// Galileo Time of Week, rounded (s)
+	static constexpr Field<I4, 8>	fGalTow{};	// Fraction of Second, galTow + fGalTow * 1e-9 (ns)
+	static constexpr Field<I2, 12>	galWno{};	// Galileo Week Number
+	static constexpr Field<I1, 14>	leapS{};	// Galileo Leap Seconds (s)
+	static constexpr Field<X1, 15>	valid{};	// Validity Flags: galTow, galWno and leapS
+	static constexpr Field<U4, 16>	tAcc{};		// Time Accuracy Estimate (ns)
+
+	GAL(const uint8_t * first, const uint8_t * last) : TIME(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief GLONASS Time Solution (UBX-NAV-TIMEGLO).
+ */
 class UBX::NAV::TIME::GLO : public UBX::NAV::TIME{
 public:
-	GLO(const vect & ubx);
+	static const U1 ID = 0x23u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<U4, 0>	iTOW{};		// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U4, 4>	TOD{};		// GLONASS Time of Day, rounded (s)
+	static constexpr Field<I4, 8>	fTOD{};		// Fraction of Second, TOD + fTOD * 1e-9 (ns)
+	static constexpr Field<U2, 12>	Nt{};		// Current Date, from 1 January of the leap year (days)
+	static constexpr Field<U1, 14>	N4{};		// Four-Year Interval Number, from 1996
+	static constexpr Field<X1, 15>	valid{};	// Validity Flags: TOD and date
+	static constexpr Field<U4, 16>	tAcc{};		// Time Accuracy Estimate (ns)
+
+	GLO(const uint8_t * first, const uint8_t * last) : TIME(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief GPS Time Solution (UBX-NAV-TIMEGPS).
+ */
 class UBX::NAV::TIME::GPS : public UBX::NAV::TIME{
 public:
-	GPS(const vect & ubx);
+	static const U1 ID = 0x20u;
+	static const U2 payloadLen = 16u;
+
+	static constexpr Field<U4, 0>	iTOW{};		// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<I4, 4>	fTOW{};		// Fraction of iTOW, iTOW * 1e-3 + fTOW * 1e-9 (ns, -500000..500000)
+	static constexpr Field<I2, 8>	week{};		// GPS Week Number
+	static constexpr Field<I1, 10>	leapS{};	// GPS Leap Seconds, GPS - UTC (s)
+	static constexpr Field<X1, 11>	valid{};	// Validity Flags: TOW, week and leapS
+	static constexpr Field<U4, 12>	tAcc{};		// Time Accuracy Estimate (ns)
+
+	GPS(const uint8_t * first, const uint8_t * last) : TIME(ID, payloadLen, first, last) {}
+
+	inline bool towValid() const	{ return get(valid) & 0x01u; }
+	inline bool weekValid() const	{ return get(valid) & 0x02u; }
+	inline bool leapSValid() const	{ return get(valid) & 0x04u; }
 };
 
+/**
+ * @brief Leap Second Event Information (UBX-NAV-TIMELS).
+ */
 class UBX::NAV::TIME::ELS : public UBX::NAV::TIME{
 public:
-	ELS(const vect & ubx);
+	static const U1 ID = 0x26u;
+	static const U2 payloadLen = 24u;
+
+	static constexpr Field<U4, 0>	iTOW{};				// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U1, 4>	version{};			// Message Version (0x00)
+	static constexpr Field<U1, 8>	srcOfCurrLs{};		// Source of the Current Leap Second Value
+	static constexpr Field<I1, 9>	currLs{};			// Current Leap Seconds since 1980-01-06 (s)
+	static constexpr Field<U1, 10>	srcOfLsChange{};	// Source of the Leap Second Event Information
+	static constexpr Field<I1, 11>	lsChange{};			// Leap Second Change at the next Event (s, -1, 0 or 1)
+	static constexpr Field<I4, 12>	timeToLsEvent{};	// Time to the next Leap Second Event (s)
+	static constexpr Field<U2, 16>	dateOfLsGpsWn{};	// GPS Week Number of the next Leap Second Event
+	static constexpr Field<U2, 18>	dateOfLsGpsDn{};	// GPS Day of Week of the next Leap Second Event (1..7)
+	static constexpr Field<X1, 23>	valid{};			// Validity Flags: currLs and timeToLsEvent
+
+	ELS(const uint8_t * first, const uint8_t * last) : TIME(ID, payloadLen, first, last) {}
+
+	inline bool validCurrLs() const			{ return get(valid) & 0x01u; }
+	inline bool validTimeToLsEvent() const	{ return get(valid) & 0x02u; }
 };
 
+/**
+ * @brief QZSS Time Solution (UBX-NAV-TIMEQZSS).
+ */
 class UBX::NAV::TIME::QZSS : public UBX::NAV::TIME{
 public:
-	QZSS(const vect & ubx);
+	static const U1 ID = 0x27u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<U4, 0>	iTOW{};		// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U4, 4>	qzssTow{};	// QZSS Time of Week, rounded (s)
+	static constexpr Field<I4, 8>	fQzssTow{};	// Fraction of Second, qzssTow + fQzssTow * 1e-9 (ns)
+	static constexpr Field<I2, 12>	qzssWno{};	// QZSS Week Number
+	static constexpr Field<I1, 14>	leapS{};	// QZSS Leap Seconds (s)
+	static constexpr Field<X1, 15>	valid{};	// Validity Flags: qzssTow, qzssWno and leapS
+	static constexpr Field<U4, 16>	tAcc{};		// Time Accuracy Estimate (ns)
+
+	QZSS(const uint8_t * first, const uint8_t * last) : TIME(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief UTC Time Solution (UBX-NAV-TIMEUTC).
+ */
 class UBX::NAV::TIME::UTC : public UBX::NAV::TIME{
 public:
-	UTC(const vect & ubx);
+	static const U1 ID = 0x21u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<U4, 0>	iTOW{};			// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<U4, 4>	tAcc{};			// Time Accuracy Estimate (ns)
+	static constexpr Field<I4, 8>	nano{};			// Fraction of Second (ns, -1e9..1e9)
+	static constexpr Field<U2, 12>	year{};			// UTC Year
+	static constexpr Field<U1, 14>	month{};		// UTC Month (1..12)
+	static constexpr Field<U1, 15>	day{};			// UTC Day of Month (1..31)
+	static constexpr Field<U1, 16>	hour{};			// UTC Hour (0..23)
+	static constexpr Field<U1, 17>	min{};			// UTC Minute (0..59)
+	static constexpr Field<U1, 18>	sec{};			// UTC Second (0..60)
+	static constexpr Field<X1, 19>	validFlags{};	// Validity Flags and UTC Standard
+
+	UTC(const uint8_t * first, const uint8_t * last) : TIME(ID, payloadLen, first, last) {}
+
+	inline bool validUTC() const { return get(validFlags) & 0x04u; }
+
+	time_t epoch() const;		// UNIX Epoch Time (s)
+	int64_t epochMs() const;	// UNIX Epoch Time, with nano (ms)
 };
 
 
@@ -173,17 +606,45 @@ public:
 	class ECEF;
 	class NED;
 protected:
-	VEL(const vect & ubx);
+	VEL(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : NAV(msgID, len, first, last) {}
 };
 
+/**
+ * @brief Velocity Solution in ECEF (UBX-NAV-VELECEF).
+ */
 class UBX::NAV::VEL::ECEF : public UBX::NAV::VEL{
 public:
-	ECEF(const vect & ubx);
+	static const U1 ID = 0x11u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<U4, 0>	iTOW{};		// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<I4, 4>	ecefVX{};	// ECEF X Velocity (cm/s)
+	static constexpr Field<I4, 8>	ecefVY{};	// ECEF Y Velocity (cm/s)
+	static constexpr Field<I4, 12>	ecefVZ{};	// ECEF Z Velocity (cm/s)
+	static constexpr Field<U4, 16>	sAcc{};		// Speed Accuracy Estimate (cm/s)
+
+	ECEF(const uint8_t * first, const uint8_t * last) : VEL(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Velocity Solution in NED (UBX-NAV-VELNED).
+ */
 class UBX::NAV::VEL::NED : public UBX::NAV::VEL{
 public:
-	NED(const vect & ubx);
+	static const U1 ID = 0x12u;
+	static const U2 payloadLen = 36u;
+
+	static constexpr Field<U4, 0>	iTOW{};			// GPS Time of Week of the Navigation Epoch (ms)
+	static constexpr Field<I4, 4>	velN{};			// North Velocity (cm/s)
+	static constexpr Field<I4, 8>	velE{};			// East Velocity (cm/s)
+	static constexpr Field<I4, 12>	velD{};			// Down Velocity (cm/s)
+	static constexpr Field<U4, 16>	speed{};		// Speed, 3-D (cm/s)
+	static constexpr Field<U4, 20>	gSpeed{};		// Ground Speed, 2-D (cm/s)
+	static constexpr Field<I4, 24>	heading{};		// Heading of Motion, 2-D (1e-5 deg)
+	static constexpr Field<U4, 28>	sAcc{};			// Speed Accuracy Estimate (cm/s)
+	static constexpr Field<U4, 32>	cAcc{};			// Course / Heading Accuracy Estimate (1e-5 deg)
+
+	NED(const uint8_t * first, const uint8_t * last) : VEL(ID, payloadLen, first, last) {}
 };
 
 
@@ -28,32 +28,135 @@ public:
 	class RTCM;
 	class SFRBX;
 	
+	static const U1 classID = 0x02u;
+
+protected:
+	RXM(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, len, first, last) {}
 };
 
 
+/**
+ * @brief Satellite Measurements for RRLP (UBX-RXM-MEASX), with the measurements of each satellite.
+ */
 class UBX::RXM::MEASX : public UBX::RXM{
 public:
-	MEASX(const vect & ubx);
+	static const U1 ID = 0x14u;
+	static const U2 payloadLen = 44u;	// Without any satellites.
+	static const U2 svLen = 24u;		// Per satellite.
+
+	static constexpr Field<U1, 0>	version{};		// Message Version (0x01)
+	static constexpr Field<U4, 4>	gpsTOW{};		// GPS Measurement Reference Time of Week (ms)
+	static constexpr Field<U4, 8>	gloTOW{};		// GLONASS Measurement Reference Time of Week (ms)
+	static constexpr Field<U4, 12>	bdsTOW{};		// BeiDou Measurement Reference Time of Week (ms)
+	static constexpr Field<U4, 20>	qzssTOW{};		// QZSS Measurement Reference Time of Week (ms)
+	static constexpr Field<U2, 24>	gpsTOWacc{};	// GPS Measurement Reference Time Accuracy (ms / 16)
+	static constexpr Field<U2, 26>	gloTOWacc{};	// GLONASS Measurement Reference Time Accuracy (ms / 16)
+	static constexpr Field<U2, 28>	bdsTOWacc{};	// BeiDou Measurement Reference Time Accuracy (ms / 16)
+	static constexpr Field<U2, 32>	qzssTOWacc{};	// QZSS Measurement Reference Time Accuracy (ms / 16)
+	static constexpr Field<U1, 34>	numSV{};		// Number of Satellites
+	static constexpr Field<X1, 35>	flags{};		// TOW Set (0 No, 1 or 2 Yes)
+
+	struct Sv{	// Offsets within each satellite's block.
+		static constexpr Field<U1, 0>	gnssId{};			// GNSS Identifier
+		static constexpr Field<U1, 1>	svId{};				// Satellite Identifier
+		static constexpr Field<U1, 2>	cNo{};				// Carrier to Noise Ratio (dBHz, 0..63)
+		static constexpr Field<U1, 3>	mpathIndic{};		// Multipath Indicator (0 Not Measured, 1 Low, 2 Medium, 3 High)
+		static constexpr Field<I4, 4>	dopplerMS{};		// Doppler Measurement (0.04 m/s)
+		static constexpr Field<I4, 8>	dopplerHz{};		// Doppler Measurement (0.2 Hz)
+		static constexpr Field<U2, 12>	wholeChips{};		// Whole Value of the Code Phase Measurement (0..1022)
+		static constexpr Field<U2, 14>	fracChips{};		// Fractional Value of the Code Phase Measurement (0..1023)
+		static constexpr Field<U4, 16>	codePhase{};		// Code Phase (2^-21 ms)
+		static constexpr Field<U1, 20>	intCodePhase{};		// Integer, millisecond part of the Code Phase (ms)
+		static constexpr Field<U1, 21>	pseuRangeRMSErr{};	// Pseudorange RMS Error Index
+	};
+
+	MEASX(const uint8_t * first, const uint8_t * last) : RXM(ID, payloadLen, first, last) {}
+
+	inline U1 count() const { return (get(numSV) < blocks(payloadLen, svLen)) ? get(numSV) : blocks(payloadLen, svLen); }
+
+	template<typename T, size_t Offset>
+	inline T sv(U1 i, Field<T, Offset> f) const { return block(payloadLen, svLen, i, f); }	// i < count()
 };
 
+/**
+ * @brief Power Management Request (UBX-RXM-PMREQ). Requests the receiver to enter backup mode, optionally woken by
+ * any of wakeupSources (bit 3 UARTRX, 5 EXTINT0, 6 EXTINT1, 7 SPICS).
+ */
 class UBX::RXM::PMREQ : public UBX::RXM{
 public:
-	PMREQ(const vect & ubx);
+	static const U1 ID = 0x41u;
+	static const U2 payloadLen = 16u;	// Version 0x00. The legacy 8-byte form carries only duration and flags.
+
+	static constexpr Field<U1, 0>	version{};			// Message Version (0x00)
+	static constexpr Field<U4, 4>	duration{};			// Duration of the Request, 0 for Infinite (ms)
+	static constexpr Field<X4, 8>	flags{};			// Bit 1 Backup, Bit 2 Force
+	static constexpr Field<X4, 12>	wakeupSources{};	// Sources which may Wake the Receiver
+
+	PMREQ(const uint8_t * first, const uint8_t * last) : RXM(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Galileo SAR Return Link Message (UBX-RXM-RLM), in a short (16 byte) or long (28 byte) form.
+ */
 class UBX::RXM::RLM : public UBX::RXM{
 public:
-	RLM(const vect & ubx);
+	static const U1 ID = 0x59u;
+	static const U2 payloadLen = 16u;	// Short form
+	static const U2 longLen = 28u;		// Long form
+
+	static constexpr Field<U1, 0>		version{};	// Message Version (0x00)
+	static constexpr Field<U1, 1>		type{};		// 0x01 Short, 0x02 Long
+	static constexpr Field<U1, 2>		svId{};		// Satellite Identifier
+	static constexpr Array<U1, 4, 8>	beacon{};	// Beacon Identifier (60 bits), most significant byte first
+	static constexpr Field<U1, 12>		message{};	// Message Code (4 bits)
+	static constexpr Array<U1, 13, 12>	params{};	// Parameters, 2 bytes in the short form and 12 in the long form
+
+	RLM(const uint8_t * first, const uint8_t * last) : RXM(ID, payloadLen, first, last) {}
+
+	inline U1 paramCount() const { return !valid() ? 0u : (len >= longLen) ? 12u : 2u; }	// Parameters in the frame received.
 };
 
+/**
+ * @brief RTCM Input Status (UBX-RXM-RTCM). Output upon each RTCM message received.
+ */
 class UBX::RXM::RTCM : public UBX::RXM{
 public:
-	RTCM(const vect & ubx);
+	static const U1 ID = 0x32u;
+	static const U2 payloadLen = 8u;
+
+	static constexpr Field<U1, 0>	version{};		// Message Version (0x02)
+	static constexpr Field<X1, 1>	flags{};		// Bit 0: CRC Failed. Bits 1..2: Used (0 Unknown, 1 Unused, 2 Used)
+	static constexpr Field<U2, 2>	subType{};		// Message Subtype (RTCM 4072 only)
+	static constexpr Field<U2, 4>	refStation{};	// Reference Station Identifier
+	static constexpr Field<U2, 6>	msgType{};		// Message Type
+
+	RTCM(const uint8_t * first, const uint8_t * last) : RXM(ID, payloadLen, first, last) {}
+
+	inline bool crcFailed() const { return get(flags) & 0x01u; }
 };
 
+/**
+ * @brief Broadcast Navigation Data Subframe (UBX-RXM-SFRBX), as words of 32 bits.
+ */
 class UBX::RXM::SFRBX : public UBX::RXM{
 public:
-	SFRBX(const vect & ubx);
+	static const U1 ID = 0x13u;
+	static const U2 payloadLen = 8u;	// Without any data words.
+	static const U2 wordLen = 4u;		// Per data word.
+
+	static constexpr Field<U1, 0>	gnssId{};	// GNSS Identifier
+	static constexpr Field<U1, 1>	svId{};		// Satellite Identifier
+	static constexpr Field<U1, 2>	sigId{};	// Signal Identifier
+	static constexpr Field<U1, 3>	freqId{};	// GLONASS Frequency Slot + 7
+	static constexpr Field<U1, 4>	numWords{};	// Number of Data Words
+	static constexpr Field<U1, 5>	chn{};		// Tracking Channel Number
+	static constexpr Field<U1, 6>	version{};	// Message Version (0x02)
+
+	SFRBX(const uint8_t * first, const uint8_t * last) : RXM(ID, payloadLen, first, last) {}
+
+	inline U1 count() const { return (get(numWords) < blocks(payloadLen, wordLen)) ? get(numWords) : blocks(payloadLen, wordLen); }
+
+	inline U4 dwrd(U1 i) const { return block(payloadLen, wordLen, i, Field<U4, 0>{}); }	// i < count()
 };
 
 /*** END OF FILE ***/
\ No newline at end of file
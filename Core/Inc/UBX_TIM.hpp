@@ -25,21 +25,74 @@ public:
 	class TM2;
 	class TP;
 	class VRFY;
+
+	static const U1 classID = 0x0Du;
+
+protected:
+	TIM(U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) : UBX(classID, msgID, len, first, last) {}
 };
 
+/**
+ * @brief Time Mark Data (UBX-TIM-TM2), the times of the last rising and falling edges on a time mark input.
+ */
 class UBX::TIM::TM2 : public UBX::TIM{
 public:
-	TM2(const vect & ubx);
+	static const U1 ID = 0x03u;
+	static const U2 payloadLen = 28u;
+
+	static constexpr Field<U1, 0>	ch{};			// Channel (EXTINT) upon which the Pulse was Measured
+	static constexpr Field<X1, 1>	flags{};		// Mode, Run, New Falling Edge, Time Base, UTC, Time Valid, New Rising Edge
+	static constexpr Field<U2, 2>	count{};		// Rising Edge Counter
+	static constexpr Field<U2, 4>	wnR{};			// Week Number of the last Rising Edge
+	static constexpr Field<U2, 6>	wnF{};			// Week Number of the last Falling Edge
+	static constexpr Field<U4, 8>	towMsR{};		// Time of Week of the Rising Edge (ms)
+	static constexpr Field<U4, 12>	towSubMsR{};	// Millisecond Fraction of towMsR (ns)
+	static constexpr Field<U4, 16>	towMsF{};		// Time of Week of the Falling Edge (ms)
+	static constexpr Field<U4, 20>	towSubMsF{};	// Millisecond Fraction of towMsF (ns)
+	static constexpr Field<U4, 24>	accEst{};		// Accuracy Estimate (ns)
+
+	TM2(const uint8_t * first, const uint8_t * last) : TIM(ID, payloadLen, first, last) {}
+
+	inline bool newFallingEdge() const	{ return get(flags) & 0x04u; }
+	inline bool timeValid() const		{ return get(flags) & 0x40u; }
+	inline bool newRisingEdge() const	{ return get(flags) & 0x80u; }
 };
 
+/**
+ * @brief Time Pulse Time Data (UBX-TIM-TP), the time of the next time pulse.
+ */
 class UBX::TIM::TP : public UBX::TIM{
 public:
-	TP(const vect & ubx);
+	static const U1 ID = 0x01u;
+	static const U2 payloadLen = 16u;
+
+	static constexpr Field<U4, 0>	towMS{};	// Time Pulse Time of Week (ms)
+	static constexpr Field<U4, 4>	towSubMS{};	// Submillisecond Part of towMS (2^-32 ms)
+	static constexpr Field<I4, 8>	qErr{};		// Quantisation Error of the Time Pulse (ps)
+	static constexpr Field<U2, 12>	week{};		// Time Pulse Week Number
+	static constexpr Field<X1, 14>	flags{};	// Time Base (GNSS or UTC), UTC Available, RAIM, Quantisation Error Invalid
+	static constexpr Field<X1, 15>	refInfo{};	// GNSS Reference and UTC Standard
+
+	TP(const uint8_t * first, const uint8_t * last) : TIM(ID, payloadLen, first, last) {}
 };
 
+/**
+ * @brief Sourced Time Verification (UBX-TIM-VRFY), the difference between the time from the RTC or assistance data
+ * and the navigation time.
+ */
 class UBX::TIM::VRFY : public UBX::TIM{
 public:
-	VRFY(const vect & ubx);
+	static const U1 ID = 0x06u;
+	static const U2 payloadLen = 20u;
+
+	static constexpr Field<I4, 0>	itow{};		// Integer Time of Week Received by Source (ms)
+	static constexpr Field<I4, 4>	frac{};		// Submillisecond Part of itow (ns)
+	static constexpr Field<I4, 8>	deltaMs{};	// Integer Milliseconds of the Navigation Time less the Source Time (ms)
+	static constexpr Field<I4, 12>	deltaNs{};	// Submillisecond Part of deltaMs (ns)
+	static constexpr Field<U2, 16>	wno{};		// Week Number
+	static constexpr Field<X1, 18>	flags{};	// Aiding Time Source (0 None, 2 RTC, 3 Assistance)
+
+	VRFY(const uint8_t * first, const uint8_t * last) : TIM(ID, payloadLen, first, last) {}
 };
 
 
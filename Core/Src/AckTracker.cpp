@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * @file			: AckTracker.cpp
+  * @brief			: Source for AckTracker.hpp
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+#include "AckTracker.hpp"
+
+/**
+ * @brief Registers a command which has just been transmitted.
+ *
+ * @param now	The current tick [ms].
+ * @return Token The request's token, or none if the table is full, in which case the callback is not called.
+ */
+AckTracker::Token AckTracker::submit(const Request & r, uint32_t now){
+	for(Token t = 0u; t < capacity; t++){
+		Entry & e = table[t];
+		if(e.active) continue;
+
+		e.r = r;
+		e.deadline = now + r.timeout;
+		e.seq = seq++;
+		e.active = true;
+		count++;
+		return t;
+	}
+	return none;
+}
+
+/**
+ * @brief Completes the oldest request in flight of the acknowledged class and ID.
+ *
+ * @param ack	True for UBX-ACK-ACK, false for UBX-ACK-NAK.
+ */
+bool AckTracker::resolve(bool ack, uint8_t msgClass, uint8_t msgID){
+	Entry * oldest = nullptr;
+	for(auto & e : table){
+		if( !e.active || (e.r.msgClass != msgClass) || (e.r.msgID != msgID) ) continue;
+		if( (oldest == nullptr) || (static_cast<int16_t>(e.seq - oldest->seq) < 0) ) oldest = &e;
+	}
+
+	if(oldest == nullptr) return false;	// Late response to a request which has already timed out.
+	finish(*oldest, ack ? Result::ACK : Result::NAK);
+	return true;
+}
+
+/**
+ * @brief Retries or times out every request past its deadline.
+ *
+ * @note A retried request is matched after any already in flight with the same class and ID.
+ */
+void AckTracker::service(uint32_t now){
+	if(count == 0u) return;
+
+	for(auto & e : table){
+		if( !e.active || (static_cast<int32_t>(now - e.deadline) < 0) ) continue;
+
+		if( (e.r.retries > 0u) && (e.r.resend != nullptr) && e.r.resend(e.r.ctx) ){
+			e.r.retries--;
+			e.deadline = now + e.r.timeout;
+			e.seq = seq++;
+		}
+		else finish(e, Result::TIMEOUT);
+	}
+}
+
+bool AckTracker::pending(Token t) const{
+	return (t < capacity) && table[t].active;
+}
+
+void AckTracker::cancel(Token t){
+	if(pending(t)) finish(table[t], Result::CANCELLED);
+}
+
+void AckTracker::clear(){
+	for(auto & e : table) if(e.active) finish(e, Result::CANCELLED);
+}
+
+void AckTracker::finish(Entry & e, Result result){
+	e.active = false;	// Released first, so that the callback may submit a follow-up request.
+	count--;
+	if(e.r.done != nullptr) e.r.done(e.r.msgClass, e.r.msgID, result, e.r.ctx);
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file			: ConfigShadow.cpp
+  * @brief			: Source for ConfigShadow.hpp
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+#include "ConfigShadow.hpp"
+
+bool ConfigShadow::lookup(UBX::X4 key, UBX::U4 & value) const{
+	for(uint8_t i = slot(key); table[i].key != 0u; i = (i + 1u) & (slots - 1u)){
+		if(table[i].key == key){
+			value = table[i].value;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConfigShadow::store(UBX::X4 key, UBX::U4 value){
+	uint8_t i = slot(key);
+	for(; table[i].key != 0u; i = (i + 1u) & (slots - 1u)){
+		if(table[i].key == key){
+			table[i].value = value;
+			return true;
+		}
+	}
+
+	if( (key == 0u) || (count >= capacity) ) return false;
+	table[i] = {key, value};
+	count++;
+	return true;
+}
+
+void ConfigShadow::clear(){
+	for(auto & e : table) e = {0u, 0u};
+	count = 0u;
+}
+
+/**
+ * @brief FNV-1a digest of the keys and values of a profile, in order.
+ */
+uint32_t ConfigShadow::hash(const KeyValuePair * first, const KeyValuePair * last){
+	uint32_t h = 2166136261u;
+	const auto mix = [&h](UBX::U4 w){
+		for(uint8_t i = 0u; i < 4u; i++){
+			h ^= static_cast<uint8_t>(w >> (8u * i));
+			h *= 16777619u;
+		}
+	};
+
+	for(; first != last; first++){
+		mix(first->keyId.toKey());
+		mix(first->raw());
+	}
+	return h;
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,99 @@
+/**
+  ******************************************************************************
+  * @file			: FixFusion.cpp
+  * @brief			: Source for FixFusion.hpp
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+#include "FixFusion.hpp"
+
+/**
+ * @brief Converts knots x 1e3 to mm/s. 1 kn = 1852 m/h.
+ */
+static inline int32_t mmps(int32_t milliKnots){ return milliKnots * 463 / 900; }
+
+bool FixFusion::receive(const NMEA_Standard::GGA & gga){
+	Fix * f = at(gga.time);
+	if(f == nullptr) return false;
+
+	f->time.hh	= gga.time.hh;
+	f->time.mm	= gga.time.mm;
+	f->time.ss	= gga.time.ss;
+	f->time.ms	= gga.time.ms;
+	f->lat		= gga.lat;
+	f->lon		= gga.lon;
+	f->alt		= gga.alt;
+	f->sep		= gga.sep;
+	f->hdop		= gga.hdop;
+	f->quality	= gga.quality;
+	f->numSV	= gga.numSV;
+	return merged(GGA);
+}
+
+bool FixFusion::receive(const NMEA_Standard::RMC & rmc){
+	Fix * f = at(rmc.time.daytime());
+	if(f == nullptr) return false;
+
+	f->time		= rmc.time;
+	f->lat		= rmc.lat;
+	f->lon		= rmc.lon;
+	f->speed	= mmps(rmc.spd);
+	f->course	= rmc.cog;
+	f->status	= rmc.status;
+	f->posMode	= rmc.posMode;
+	return merged(RMC);
+}
+
+bool FixFusion::receive(const NMEA_Standard::VTG & vtg){
+	if(state != State::OPEN) return false;
+
+	Fix & f = fixes[front ^ 1u];
+	if(!(f.parts & RMC)){	// RMC gives the same, and is preferred for being of a known time.
+		f.speed		= mmps(vtg.sogn);
+		f.course	= vtg.cogt;
+		f.posMode	= vtg.posMode;
+	}
+	return merged(VTG);
+}
+
+/**
+ * @brief The back record for UTC time of day t, starting a new record if t differs from that being assembled.
+ *
+ * @return nullptr if the record of time t has already been made current.
+ */
+FixFusion::Fix * FixFusion::at(uint32_t t){
+	if( (state != State::IDLE) && (t == daytime) ){
+		if(state == State::DONE) return nullptr;
+	}
+	else{
+		if(state == State::OPEN) dropped++;
+		fixes[front ^ 1u] = {};
+		fixes[front ^ 1u].status = 'V';
+		daytime = t;
+		state = State::OPEN;
+	}
+	return &fixes[front ^ 1u];
+}
+
+bool FixFusion::merged(uint8_t part){
+	Fix & f = fixes[front ^ 1u];
+	f.parts |= part;
+	if((f.parts & required) != required) return false;
+
+	front ^= 1u;	// Publish. A single byte write.
+	state = State::DONE;
+	return true;
+}
+
+/*** END OF FILE ***/
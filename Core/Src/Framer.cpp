@@ -0,0 +1,195 @@
+/**
+  ******************************************************************************
+  * @file			: Framer.cpp
+  * @brief			: Source for Framer.hpp
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+#include "Framer.hpp"
+#include "Scan.hpp"
+
+/**
+ * @brief Scans forward for the next complete frame.
+ *
+ * @param v	View of the unread data. Must start at the same character as the views given since the last release().
+ * @param f	Set to the location of the frame if one is found.
+ * @return true if a complete frame was found. false if the view is exhausted.
+ */
+bool Framer::next(const SegmentedView & v, Frame & f){
+	while(pos < v.size()){
+		/* Runs of characters which cannot change the state are passed over in bulk */
+		if(state == State::IDLE) pos += skip(v);
+		else if(state == State::NMEA_BODY) pos += body(v);
+		if(pos >= v.size()) break;
+
+		const State s = state;
+		if(step(v[pos++])){
+			f.protocol = (s == State::NMEA_LF) ? Protocol::NMEA : Protocol::UBX;
+			f.begin = start;
+			f.size = pos - start;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * @brief Rebases the framer after the view has been exhausted.
+ *
+ * @return uint16_t The number of leading characters which will not be referred to again and must be consumed.
+ */
+uint16_t Framer::release(){
+	const uint16_t n = (state == State::IDLE) ? pos : start;
+	pos -= n;
+	start = (state == State::IDLE) ? 0u : start - n;
+	return n;
+}
+
+void Framer::reset(){
+	state = State::IDLE;
+	pos = start = 0u;
+}
+
+uint16_t Framer::skip(const SegmentedView & v) const{
+	const uint8_t * p;
+	const uint16_t n = v.run(pos, p);
+	return Scan::find(p, n, '$', 0xB5u);
+}
+
+uint16_t Framer::body(const SegmentedView & v){
+	const uint8_t * p;
+	uint16_t n = v.run(pos, p);
+
+	// The step() length check still applies to the first character beyond this limit.
+	const uint16_t limit = start + maxNmea - 5u - pos;
+	if(n > limit) n = limit;
+
+	return Scan::printable(p, n, '*', '$', ckA);
+}
+
+bool Framer::step(uint8_t c){
+	switch(state){
+		case State::IDLE: return begin(c);
+
+		/* NMEA: $<printable characters>*hh\r\n */
+		case State::NMEA_BODY: {
+			if(c == '*') state = State::NMEA_CK1;
+			else if( (c < 0x20u) || (c > 0x7Eu) || (c == '$') ) return fail(c);
+			else if(pos - start > maxNmea - 5) return fail(c);	// No room left for "*hh\r\n".
+			else ckA ^= c;
+			return false;
+		}
+		case State::NMEA_CK1: {
+			const auto h = hex(c);
+			if(h < 0) return fail(c);
+			ckB = h << 4;
+			state = State::NMEA_CK2;
+			return false;
+		}
+		case State::NMEA_CK2: {
+			const auto h = hex(c);
+			if( (h < 0) || ((ckB | h) != ckA) ) return fail(c);
+			state = State::NMEA_CR;
+			return false;
+		}
+		case State::NMEA_CR: {
+			if(c != '\r') return fail(c);
+			state = State::NMEA_LF;
+			return false;
+		}
+		case State::NMEA_LF: {
+			if(c != '\n') return fail(c);
+			stats.nmea++;
+			state = State::IDLE;
+			return true;
+		}
+
+		/* UBX: μ b class id len(2) payload(len) ckA ckB. Fletcher checksum over class to end of payload. */
+		case State::UBX_SYNC2: {
+			if(c != 0x62u) return fail(c);
+			ckA = ckB = 0u;
+			state = State::UBX_CLASS;
+			return false;
+		}
+		case State::UBX_CLASS: {
+			fletcher(c);
+			state = State::UBX_ID;
+			return false;
+		}
+		case State::UBX_ID: {
+			fletcher(c);
+			state = State::UBX_LEN1;
+			return false;
+		}
+		case State::UBX_LEN1: {
+			fletcher(c);
+			remaining = c;
+			state = State::UBX_LEN2;
+			return false;
+		}
+		case State::UBX_LEN2: {
+			fletcher(c);
+			remaining |= static_cast<uint16_t>(c) << 8;
+			if(remaining > maxUbxPayload) return fail(c);
+			state = (remaining > 0u) ? State::UBX_PAYLOAD : State::UBX_CKA;
+			return false;
+		}
+		case State::UBX_PAYLOAD: {
+			fletcher(c);
+			if(--remaining == 0u) state = State::UBX_CKA;
+			return false;
+		}
+		case State::UBX_CKA: {
+			if(c != ckA) return fail(c);
+			state = State::UBX_CKB;
+			return false;
+		}
+		case State::UBX_CKB: {
+			if(c != ckB) return fail(c);
+			stats.ubx++;
+			state = State::IDLE;
+			return true;
+		}
+
+		default: return fail(c);
+	}
+}
+
+bool Framer::begin(uint8_t c){
+	if(c == '$'){
+		state = State::NMEA_BODY;
+		start = pos - 1u;
+		ckA = 0u;
+	}
+	else if(c == 0xB5u){
+		state = State::UBX_SYNC2;
+		start = pos - 1u;
+	}
+	else state = State::IDLE;
+	return false;
+}
+
+bool Framer::fail(uint8_t c){
+	stats.errors++;
+	return begin(c);	// c may itself be the start of the next frame.
+}
+
+int8_t Framer::hex(uint8_t c){
+	if( (c >= '0') && (c <= '9') ) return c - '0';
+	else if( (c >= 'A') && (c <= 'F') ) return c - 'A' + 10;
+	else if( (c >= 'a') && (c <= 'f') ) return c - 'a' + 10;
+	else return -1;
+}
+
+/*** END OF FILE ***/
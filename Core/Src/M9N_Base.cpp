@@ -20,7 +20,7 @@
 #include "M9N_Base.hpp"
 
 void M9N_Base::setRate(NMEA_PUBX::Rate rate){
-	char buff[30];
+	char buff[40];
 	transmit(rate.toString(buff));
 }
 
@@ -28,7 +28,8 @@ void M9N_Base::setConfig(NMEA_PUBX::Config cfg){
 	char buff[36];
 	transmit(cfg.toString(buff));
 
-	if(cfg.baudrate != baud) setBaudrate(cfg.baudrate, cfg.portId);
+	// The command must have left at the old baudrate before the interface is switched.
+	if( (cfg.baudrate != baud) && drain(drainTimeout) ) setBaudrate(cfg.baudrate, cfg.portId);
 }
 
 void M9N_Base::silenceDefaultRates(){
@@ -23,11 +23,59 @@
 
 extern UART_HandleTypeDef huart4;
 M9N m9n{ &huart4, UART4_IRQn, DMA1_Channel2_IRQn, DMA1_Channel1_IRQn };
-uint32_t midnight = 0;
+uint32_t midnight = 0;	// UNIX Epoch Time of the start of the current UTC day [s], from ZDA, RMC or PUBX,04.
+
+/**
+ * @brief UNIX Epoch Time [s] of a UTC time of day [ms] within the current day.
+ */
+static inline uint32_t today(uint32_t daytime){
+	return midnight + daytime / 1000u;
+}
 
 GPS_Init_msg_t GPS_Init(){
-	m9n.init();
-	return GPS_Init_OK;
+	switch(m9n.init()){
+		case AckTracker::Result::ACK:		return GPS_Init_OK;
+		case AckTracker::Result::NAK:		return GPS_Init_MSG_Config_Error;
+		case AckTracker::Result::UNSENT:	return GPS_Init_Ack_Tx_Error;
+		default:							return GPS_Init_Ack_Error;
+	}
+}
+
+/**
+ * @brief Reports the receiver's response to a configuration command.
+ */
+static UBX_MSG_t toUbxMsg(AckTracker::Result result){
+	switch(result){
+		case AckTracker::Result::ACK:		return UBX_ACK_ACK;
+		case AckTracker::Result::NAK:		return UBX_ACK_NACK;
+		case AckTracker::Result::TIMEOUT:	return UBX_TIMEOUT_Rx;
+		case AckTracker::Result::UNSENT:	return UBX_TIMEOUT_Tx;
+		default:							return UBX_ERROR;
+	}
+}
+
+/* Constant Configurations. Encoded at compile time into flash. */
+static constexpr UBX::CFG::VAL::KeyValuePair updateRate[] = {
+	{CFG_RATE_MEAS, GPS_UPDATE_PERIOD},
+	{CFG_RATE_NAV, 1u}
+};
+static constexpr UBX::CFG::VAL::KeyValuePair lpEnable[] = { {CFG_PM_OPERATEMODE, UBX::CFG::VAL::CFG_PM_OPERATEMODE::PSMCT} };
+static constexpr UBX::CFG::VAL::KeyValuePair lpDisable[] = { {CFG_PM_OPERATEMODE, UBX::CFG::VAL::CFG_PM_OPERATEMODE::FULL} };
+
+static constexpr auto updateRateFrame = UBX::CFG::VAL::SET::encode<updateRate>();
+static constexpr auto lpEnableFrame = UBX::CFG::VAL::SET::encode<lpEnable>();
+static constexpr auto lpDisableFrame = UBX::CFG::VAL::SET::encode<lpDisable>();
+
+UBX_MSG_t GPS_UpdateRate_Config(){
+	return toUbxMsg(m9n.sendAndWait(UBX::Encoded(updateRateFrame)));
+}
+
+UBX_MSG_t GPS_LP_Enable(){
+	return toUbxMsg(m9n.sendAndWait(UBX::Encoded(lpEnableFrame)));
+}
+
+UBX_MSG_t GPS_LP_Disable(){
+	return toUbxMsg(m9n.sendAndWait(UBX::Encoded(lpDisableFrame)));
 }
 
 void GPS_Update(){
@@ -50,20 +98,15 @@ void receiveGLL(const NMEA_Standard::GLL & gll){
 	gpsDataLive.coordinates.tic = HAL_GetTick();
 	gpsDataLive.coordinates.lat = gll.lat;
 	gpsDataLive.coordinates.longi = gll.lon;
-	gpsDataLive.coordinates.time = midnight + gll.time;
+	gpsDataLive.coordinates.time = today(gll.time.daytime());
 }
 
 void receiveGSA(const NMEA_Standard::GSA & gsa){
 	static const uint32_t ticTimeDelayThreshold = 5000u;
 
-	gpsDataLive.diag.HDOP.digit = static_cast<int>(gsa.hdop);
-	gpsDataLive.diag.HDOP.precision = static_cast<int>( (gsa.hdop - gpsDataLive.diag.HDOP.digit)*100 );
-	gpsDataLive.diag.VDOP.digit = static_cast<int>(gsa.vdop);
-	gpsDataLive.diag.VDOP.precision = static_cast<int>((gsa.vdop - gpsDataLive.diag.VDOP.digit) * 100);
-	gpsDataLive.diag.PDOP.digit = static_cast<int>(gsa.pdop);
-	gpsDataLive.diag.PDOP.precision = static_cast<int>((gsa.pdop - gpsDataLive.diag.PDOP.digit) * 100);
-	
-	gpsDataLive.diag.num_sats = std::count_if(gsa.svid.begin(), gsa.svid.end(), [](uint8_t n) -> bool { return n!=0; } );	// TODO: GSA Receives Satellite IDs, not the number of sattelites
+	gpsDataLive.diag.HDOP = gsa.hdop;
+	gpsDataLive.diag.VDOP = gsa.vdop;
+	gpsDataLive.diag.PDOP = gsa.pdop;
 	
 	gpsDataLive.diag.fix_type = gsa.navMode;
 	
@@ -71,12 +114,109 @@ void receiveGSA(const NMEA_Standard::GSA & gsa){
 
 	if(delaySinceLocation < 0) 							gpsDataLive.diag.time = 0;
 	else if(delaySinceLocation < ticTimeDelayThreshold) gpsDataLive.diag.time = gpsDataLive.coordinates.time;
-	else 												gpsDataLive.diag.time = gpsDataLive.coordinates.time + delaySinceLocation;
+	else 												gpsDataLive.diag.time = gpsDataLive.coordinates.time + delaySinceLocation / 1000u;
+}
+
+/**
+ * @brief Publishes the number of satellites tracked, upon each complete GSV group or PUBX,03 sentence.
+ */
+void receiveGSV(const SatelliteTable & sats){
+	gpsDataLive.diag.num_sats = sats.summary().tracked;
+}
+
+/**
+ * @brief Publishes a fix merged from the GGA, RMC and VTG sentences of one epoch.
+ */
+void receiveFix(const FixFusion::Fix & fix){
+	gpsDataLive.coordinates.tic = HAL_GetTick();
+	if( (fix.quality != 0u) || (fix.status == 'A') ){
+		gpsDataLive.coordinates.lat = fix.lat;
+		gpsDataLive.coordinates.longi = fix.lon;
+		gpsDataLive.coordinates.alt = fix.alt;
+		gpsDataLive.coordinates.speed = fix.speed;
+		gpsDataLive.coordinates.course = fix.course;
+	}
+	if(fix.time.year != 0u) midnight = fix.time.midnight();	// RMC gives the date in place of ZDA.
+	gpsDataLive.coordinates.time = today(fix.time.daytime());
+
+	gpsDataLive.diag.fix_quality = fix.quality;
 }
 
 void receiveZDA(const NMEA_Standard::ZDA & zda){
 	midnight = zda.time.midnight();
 }
 
+/**
+ * @brief Publishes a complete navigation epoch, in place of the GLL, GSA and ZDA sentences.
+ * 
+ * @note HDOP and VDOP are not part of NAV-PVT and are left unchanged.
+ */
+void receivePVT(const UBX::NAV::PVT & pvt){
+	gpsDataLive.coordinates.tic = HAL_GetTick();
+	if(!pvt.invalidLlh()){
+		// NAV-PVT is already in the units of GPS_Struct.h.
+		gpsDataLive.coordinates.lat = pvt.get(pvt.lat);
+		gpsDataLive.coordinates.longi = pvt.get(pvt.lon);
+		gpsDataLive.coordinates.alt = pvt.get(pvt.hMSL);
+	}
+	gpsDataLive.coordinates.speed = pvt.get(pvt.gSpeed);
+	gpsDataLive.coordinates.course = pvt.get(pvt.headMot);
+	if(pvt.validDate() && pvt.validTime()) gpsDataLive.coordinates.time = pvt.epoch();
+
+	gpsDataLive.diag.PDOP = pvt.get(pvt.pDOP);
+	gpsDataLive.diag.num_sats = pvt.get(pvt.numSV);
+	gpsDataLive.diag.fix_quality = pvt.gnssFixOK() ? 1 : 0;	// Autonomous. Differential and RTK are not reported.
+
+	switch(static_cast<UBX::NAV::PVT::FixType>(pvt.get(pvt.fixType))){	// As per the GSA navMode.
+		case UBX::NAV::PVT::FixType::FIX_2D:	gpsDataLive.diag.fix_type = 2; break;
+		case UBX::NAV::PVT::FixType::FIX_3D:
+		case UBX::NAV::PVT::FixType::GNSS_DR:	gpsDataLive.diag.fix_type = 3; break;
+		default:								gpsDataLive.diag.fix_type = 1; break;
+	}
+
+	gpsDataLive.diag.time = gpsDataLive.coordinates.time;
+}
+
+/**
+ * @brief Publishes a complete navigation epoch from PUBX,00, in place of the GLL, GSA and ZDA sentences.
+ * 
+ * @note PDOP is not part of PUBX,00 and is left unchanged. The altitude is above the ellipsoid rather than sea level.
+ */
+void receivePUBX(const M9N_Base::NMEA_PUBX::Position & position){
+	using NavStatus = M9N_Base::NMEA_PUBX::Position::NavStatus;
+
+	gpsDataLive.coordinates.tic = HAL_GetTick();
+	if( (position.navStat != NavStatus::NF) && (position.navStat != NavStatus::TT) ){
+		gpsDataLive.coordinates.lat = position.lat;
+		gpsDataLive.coordinates.longi = position.lon;
+		gpsDataLive.coordinates.alt = position.altRef;
+		gpsDataLive.coordinates.speed = position.sog * 5 / 18;	// m/h to mm/s
+		gpsDataLive.coordinates.course = position.cog;
+	}
+	gpsDataLive.coordinates.time = today(position.time.daytime());
+
+	gpsDataLive.diag.HDOP = position.hdop;
+	gpsDataLive.diag.VDOP = position.vdop;
+	gpsDataLive.diag.num_sats = position.numSvs;
+
+	switch(position.navStat){	// As per the GSA navMode and GGA quality.
+		case NavStatus::G2:	gpsDataLive.diag.fix_type = 2; gpsDataLive.diag.fix_quality = 1; break;
+		case NavStatus::D2:	gpsDataLive.diag.fix_type = 2; gpsDataLive.diag.fix_quality = 2; break;
+		case NavStatus::G3:	gpsDataLive.diag.fix_type = 3; gpsDataLive.diag.fix_quality = 1; break;
+		case NavStatus::D3:	gpsDataLive.diag.fix_type = 3; gpsDataLive.diag.fix_quality = 2; break;
+		case NavStatus::RK:
+		case NavStatus::DR:	gpsDataLive.diag.fix_type = 3; gpsDataLive.diag.fix_quality = 6; break;
+		default:			gpsDataLive.diag.fix_type = 1; gpsDataLive.diag.fix_quality = 0; break;
+	}
+
+	gpsDataLive.diag.time = gpsDataLive.coordinates.time;
+}
+
+/**
+ * @brief Takes the date from PUBX,04, in place of ZDA.
+ */
+void receivePUBX(const M9N_Base::NMEA_PUBX::Time & time){
+	if(time.time.year != 0u) midnight = time.time.midnight();
+}
 
 /*** END OF FILE ***/
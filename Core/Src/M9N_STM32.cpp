@@ -21,34 +21,345 @@
 #include <array>
 #include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "M9N_C_API.hpp"
+#include "UBX_ACK.hpp"
+#include "UBX_NAV.hpp"
 
 M9N::M9N(UART_HandleTypeDef * h, IRQn_Type uartIrq, IRQn_Type dmaTxIrq, IRQn_Type dmaRxIrq) :
 	uart(h, uartIrq, dmaTxIrq, dmaRxIrq) {}
 
-void M9N::init(){
-	const std::array<NMEA_PUBX::Message, 7u> msgs = {  
-		NMEA_PUBX::Message::GSV, 
-		NMEA_PUBX::Message::RMC, 
-		NMEA_PUBX::Message::VTG,
-		NMEA_PUBX::Message::TXT 
-		};
+/**
+ * @brief Receiver configuration applied by init(). Held in flash.
+ */
+static constexpr UBX::CFG::VAL::KeyValuePair bootProfile[] = {
+	/* Message Output */
+	#if M9N_NAV_PVT
+	{CFG_MSGOUT_UBX_NAV_PVT_UART1,	static_cast<UBX::U1>(1u)},
+	{CFG_MSGOUT_NMEA_ID_GGA_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_RMC_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_GLL_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_GSA_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_ZDA_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_GSV_UART1,	static_cast<UBX::U1>(0u)},
+	#elif M9N_PUBX
+	{CFG_MSGOUT_PUBX_ID_POLYP_UART1,	static_cast<UBX::U1>(1u)},
+	{CFG_MSGOUT_PUBX_ID_POLYT_UART1,	static_cast<UBX::U1>(M9N::pubxTimeInterval)},
+	{CFG_MSGOUT_NMEA_ID_GGA_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_RMC_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_GLL_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_GSA_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_ZDA_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_GSV_UART1,	static_cast<UBX::U1>(0u)},
+	#else
+	{CFG_MSGOUT_NMEA_ID_GGA_UART1,	static_cast<UBX::U1>(1u)},	// GGA and RMC carry all of GLL and ZDA.
+	{CFG_MSGOUT_NMEA_ID_RMC_UART1,	static_cast<UBX::U1>(1u)},
+	{CFG_MSGOUT_NMEA_ID_GLL_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_GSA_UART1,	static_cast<UBX::U1>(1u)},
+	{CFG_MSGOUT_NMEA_ID_ZDA_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_MSGOUT_NMEA_ID_GSV_UART1,	static_cast<UBX::U1>(1u)},
+	#endif
+	{CFG_MSGOUT_NMEA_ID_VTG_UART1,	static_cast<UBX::U1>(0u)},
+	{CFG_INFMSG_NMEA_UART1,			static_cast<UBX::U1>(0u)},	// TXT
+
+	/* Navigation Rate */
+	{CFG_RATE_MEAS,					static_cast<UBX::U2>(1000u)},	// 1 Hz, as the outputs above are per solution.
+	{CFG_RATE_NAV,					static_cast<UBX::U2>(1u)},
+
+	/* Power */
+	{CFG_PM_OPERATEMODE,			UBX::CFG::VAL::CFG_PM_OPERATEMODE::FULL},
+};
 
-	for(auto m : msgs)
-		setRate(NMEA_PUBX::Rate(m));
-		
-	uart.rx.beginReceive();
+/**
+ * @brief Begins reception and applies the boot profile, waiting for its acknowledgement.
+ * 
+ * @param digest	See apply().
+ */
+AckTracker::Result M9N::init(uint32_t * digest){
+	uart.rx.beginReceive();	// Acknowledgements must be received.
+
+	#if M9N_AUTOBAUD
+	if(!autobaud().locked) return AckTracker::Result::TIMEOUT;
+	#endif
+
+	const auto result = apply(std::begin(bootProfile), std::end(bootProfile), UBX::CFG::VAL::SET::Layers::RAM, digest);
+
+	#if M9N_MAX_BAUD
+	if(result == AckTracker::Result::ACK) escalate(static_cast<Baud>(M9N_MAX_BAUD));
+	#endif
+	return result;
 }
 
 void M9N::transmit(const uint8_t * first, const uint8_t * last){
 	uart.tx.transmit(first, last);	// Delegate
 }
 
-void M9N::transmit(UBX::CFG::VAL::SET set){
-	auto data = set.binary();
-	transmit(data.first.begin(), data.first.begin() + data.second);
+/**
+ * @brief Transmits a frame encoded ahead of time directly from where it is held, without copying.
+ */
+bool M9N::transmit(const UBX::Encoded & msg){
+	return uart.tx.transmitInPlace(msg.begin(), msg.end());
+}
+
+/**
+ * @brief Queues a frame encoded ahead of time directly from where it is held. Never waits.
+ * 
+ * @return UART::Tx::Token wouldBlock if the Tx queue is full, in which case it should be posted again later.
+ */
+UART::Tx::Token M9N::post(const UBX::Encoded & msg, UART::Tx::Notify done, void * ctx){
+	return uart.tx.submitInPlace(msg.begin(), msg.end(), done, ctx);
+}
+
+/**
+ * @brief Queues caller-owned, ready-framed UBX data, such as an MGA assistance database, without copying. Never waits.
+ * 
+ * @param lane	BULK by default, so that commands are not held up behind the upload.
+ * @note The data must remain unchanged until sent. It is not limited by the size of the Tx buffer.
+ * @return UART::Tx::Token wouldBlock if the Tx queue is full, in which case it should be posted again later.
+ */
+UART::Tx::Token M9N::post(const uint8_t * first, const uint8_t * last, UART::Tx::Notify done, void * ctx, UART::Tx::Lane lane){
+	return uart.tx.submitInPlace(first, last, done, ctx, lane);
+}
+
+/**
+ * @brief Sets the key-value pairs [first, last) with as few frames as possible, waiting for each to be acknowledged.
+ * 
+ * Frames are limited to SET::maxKeys keys and the size of the Tx buffer. Keys which fit a single frame are set
+ * without a transaction. Otherwise the frames form one transaction, so that the receiver applies either all of the
+ * keys or none of them.
+ * 
+ * @return AckTracker::Result ACK once all frames are acknowledged, else the result of the first frame which was not.
+ */
+AckTracker::Result M9N::configure(const UBX::CFG::VAL::KeyValuePair * first, const UBX::CFG::VAL::KeyValuePair * last,
+	UBX::CFG::VAL::SET::Layers layers){
+	using SET = UBX::CFG::VAL::SET;
+	using Action = UBX::CFG::VAL::Action;
+
+	auto action = ( (last - first <= SET::maxKeys) && (SET::frameSize(first, last) <= UART::Tx::capacity) ) ?
+		Action::TRANSACTIONLESS : Action::RE_START;
+
+	while(first != last){
+		/* Gather the next frame */
+		auto end = first;
+		auto size = SET::frameSize(first, first);
+		while( (end != last) && (end - first < SET::maxKeys) && (size + 4u + end->size() <= UART::Tx::capacity) )
+			size += 4u + (end++)->size();
+		if(end == first) return AckTracker::Result::UNSENT;	// Unreachable for any valid key.
+
+		if( (end == last) && (action != Action::TRANSACTIONLESS) ) action = Action::APPLY;
+
+		const auto result = sendAndWait(SET::TRANSACTION(action, first, end, layers));
+		if(result != AckTracker::Result::ACK) return result;	// A transaction left open is discarded by the next RE_START.
+
+		if(action == Action::RE_START) action = Action::ONGOING;
+		for(; first != end; first++) shadow.store(first->keyId.toKey(), first->raw());
+	}
+	return AckTracker::Result::ACK;
+}
+
+/**
+ * @brief Sets only those key-value pairs of [first, last) whose values differ from the receiver's.
+ * 
+ * Each of the given layers is polled and set on its own, so that a value persisted in BBR or flash does not hide a
+ * different value in RAM, nor the reverse. RAM is done last, leaving its values in the shadow. Keys absent from a
+ * polled layer are sent regardless. Profiles larger than the shadow are sent in full.
+ * 
+ * @param digest	If given, the profile's ConfigShadow::hash() when last applied. Nothing is polled or sent if the
+ * 					profile is unchanged, and the digest is updated once the profile is applied. The caller persists it
+ * 					across resets and must reset it if the receiver's configuration may have been lost.
+ * @return AckTracker::Result ACK once every layer is applied. Else the result of the first poll or set which was not
+ * 		   acknowledged, and nothing more is sent. A poll is NAKed if the receiver does not know one of the keys, which it
+ * 		   would then also refuse to set.
+ */
+AckTracker::Result M9N::apply(const UBX::CFG::VAL::KeyValuePair * first, const UBX::CFG::VAL::KeyValuePair * last,
+	UBX::CFG::VAL::SET::Layers layers, uint32_t * digest){
+	using Layers = UBX::CFG::VAL::SET::Layers;
+	using Layer = UBX::CFG::VAL::GET::Layer;
+	static const std::pair<Layers, Layer> order[] = {
+		{Layers::FLSH, Layer::FLSH},
+		{Layers::BBR, Layer::BBR},
+		{Layers::RAM, Layer::RAM}
+	};
+
+	const auto h = ConfigShadow::hash(first, last);
+	if( (digest != nullptr) && (*digest == h) ) return AckTracker::Result::ACK;	// Fast path: unchanged.
+
+	auto result = AckTracker::Result::ACK;
+	if(last - first > ConfigShadow::capacity) result = configure(first, last, layers);
+	else for(const auto & l : order){
+		if( !(static_cast<UBX::X1>(layers) & static_cast<UBX::X1>(l.first)) ) continue;
+
+		shadow.clear();	// Values of other layers, or keys absent from the polled layer, must not be trusted.
+		result = poll(first, last, l.second);
+		if(result != AckTracker::Result::ACK) break;
+
+		uint8_t n = 0u;
+		for(auto kv = first; kv != last; kv++) if(!shadow.matches(*kv)) diffBuff[n++] = *kv;
+		result = configure(diffBuff.data(), diffBuff.data() + n, l.first);
+		if(result != AckTracker::Result::ACK) break;
+	}
+
+	if( (result == AckTracker::Result::ACK) && (digest != nullptr) ) *digest = h;
+	return result;
+}
+
+/**
+ * @brief Polls the receiver's values of the keys of [first, last) into the shadow.
+ * 
+ * Requests are limited to POLL_REQ::maxKeys keys and to responses which fit the framer.
+ * 
+ * @return AckTracker::Result ACK once all requests are acknowledged, else the result of the first which was not.
+ */
+AckTracker::Result M9N::poll(const UBX::CFG::VAL::KeyValuePair * first, const UBX::CFG::VAL::KeyValuePair * last,
+	UBX::CFG::VAL::GET::Layer layer){
+	using POLL_REQ = UBX::CFG::VAL::GET::POLL_REQ;
+	std::array<UBX::CFG::VAL::KeyID, POLL_REQ::maxKeys> keys;
+
+	while(first != last){
+		uint8_t n = 0u;
+		uint16_t size = 4u;	// Response payload
+		while( (first != last) && (n < keys.size()) && (size + 4u + first->size() <= Framer::maxUbxPayload) ){
+			size += 4u + first->size();
+			keys[n++] = (first++)->keyId;
+		}
+		if(n == 0u) return AckTracker::Result::UNSENT;	// Unreachable for any valid key.
+
+		const auto result = sendAndWait(POLL_REQ(keys.data(), keys.data() + n, layer));	// POLLED precedes the ACK.
+		if(result != AckTracker::Result::ACK) return result;
+	}
+	return AckTracker::Result::ACK;
+}
+
+/**
+ * @brief Polled to verify or discover the baudrate of the link.
+ */
+static constexpr UBX::CFG::VAL::KeyID baudKey[] = {CFG_UART1_BAUDRATE};
+
+/**
+ * @brief Finds the receiver's baudrate by listening for frames with valid checksums at each Baud value in turn.
+ * 
+ * The current baudrate is tried first, then the others in ascending order. Each is given up to window ms, and a poll is
+ * sent at the start of each window so that a receiver with its periodic output disabled also answers. A baudrate at
+ * which lockFrames valid frames arrive without any framing error is locked in at once. Otherwise, once all have been
+ * tried, the baudrate with the most valid frames net of framing errors is locked in.
+ * 
+ * @return Autobaud The baudrate in use afterwards, which is unchanged if no valid frame was received at any.
+ */
+M9N::Autobaud M9N::autobaud(uint32_t window){
+	using POLL_REQ = UBX::CFG::VAL::GET::POLL_REQ;
+	static constexpr Baud rates[] = {Baud::B9600, Baud::B19200, Baud::B38400, Baud::B115200, Baud::B230400,
+		Baud::B460800, Baud::B921600};
+
+	const auto start = HAL_GetTick();
+	const Baud initial = baud;
+	Autobaud best{initial, false, 0u, 0u};
+	int32_t bestScore = 0;
+
+	for(int8_t i = -1; i < static_cast<int8_t>(std::size(rates)); i++){
+		const Baud b = (i < 0) ? initial : rates[i];
+		if( (i >= 0) && (b == initial) ) continue;
+
+		setBaudrate(b);
+		uart.rx.consume(uart.rx.peek().size());	// Characters received at another baudrate.
+		framer.reset();
+		const auto before = framer.statistics();
+		transmit(POLL_REQ(std::begin(baudKey), std::end(baudKey)));
+
+		uint16_t frames = 0u;
+		uint32_t errors = 0u;
+		const auto tik = HAL_GetTick();
+		do{
+			delay(10u);
+			scanMessages();
+			const auto & now = framer.statistics();
+			frames = (now.nmea - before.nmea) + (now.ubx - before.ubx);
+			errors = now.errors - before.errors;
+		} while( (HAL_GetTick() - tik < window) && !( (frames >= lockFrames) && (errors == 0u) ) );
+
+		const int32_t score = static_cast<int32_t>(frames) - static_cast<int32_t>(errors);
+		if( (frames > 0u) && (score > bestScore) ){
+			best = {b, true, frames, 0u};
+			bestScore = score;
+			if( (frames >= lockFrames) && (errors == 0u) ) break;
+		}
+	}
+
+	setBaudrate(best.baud);
+	best.elapsed = HAL_GetTick() - start;
+	return best;
+}
+
+/**
+ * @brief Changes the baudrate of the receiver's UART1 and of the MCU, then verifies the link.
+ * 
+ * Should be called with no acknowledged command in flight. Upon failure both ends are returned to the previous
+ * baudrate and the link is verified there.
+ * 
+ * @return AckTracker::Result ACK if the link is verified at the new baudrate, else the result of the failed probe.
+ */
+AckTracker::Result M9N::changeBaudrate(Baud to){
+	const Baud from = baud;
+	if(to == from) return probe();
+
+	const auto result = switchBaudrate(to);
+	if(result != AckTracker::Result::ACK) switchBaudrate(from);	// Lost harmlessly if the receiver never switched.
+	return result;
+}
+
+/**
+ * @brief Steps the link up through each Baud value faster than the current one, up to ceiling, stopping at the
+ * 		  fastest which is verified to be stable.
+ * 
+ * @return Baud The baudrate in use afterwards.
+ */
+M9N_Base::Baud M9N::escalate(Baud ceiling){
+	static constexpr Baud steps[] = {Baud::B9600, Baud::B19200, Baud::B38400, Baud::B115200, Baud::B230400,
+		Baud::B460800, Baud::B921600};
+
+	for(auto b : steps){
+		if(b <= baud) continue;
+		if( (b > ceiling) || (changeBaudrate(b) != AckTracker::Result::ACK) ) break;
+	}
+	return baud;
+}
+
+/**
+ * @brief Instructs the receiver to change baudrate, then follows with the MCU once the instruction has been sent.
+ * 
+ * The receiver switches while processing the CFG-VALSET, so its acknowledgement may be lost and is not awaited.
+ * The value is set in RAM only, so that a baudrate which fails is not kept over a reset.
+ */
+AckTracker::Result M9N::switchBaudrate(Baud to){
+	const UBX::CFG::VAL::SET set{{CFG_UART1_BAUDRATE, static_cast<UBX::U4>(to)}};
+	if(!transmit(set) || !drain(drainTimeout)) return AckTracker::Result::UNSENT;
+
+	delay(baudSettle);
+	scanMessages();		// Anything received at the old baudrate.
+	setBaudrate(to);
+	return probe();
+}
+
+/**
+ * @brief Verifies the link by polling the receiver's UART1 baudrate, which must match the MCU's, probes times.
+ * 
+ * @return AckTracker::Result ACK only if every poll is answered correctly and no framing error occurs after the
+ * 		   first, which follows any characters garbled by a baudrate change. NAK upon a wrong value or framing error.
+ */
+AckTracker::Result M9N::probe(){
+	using POLL_REQ = UBX::CFG::VAL::GET::POLL_REQ;
+
+	uint32_t errors = 0u;
+	for(uint8_t i = 0u; i < probes; i++){
+		polledBaud = 0u;	// Invalidated, so that only a fresh response is accepted.
+		const auto result = sendAndWait(POLL_REQ(std::begin(baudKey), std::end(baudKey)), 1u, probeTimeout);
+		if(result != AckTracker::Result::ACK) return result;
+
+		if(polledBaud != static_cast<UBX::U4>(baud)) return AckTracker::Result::NAK;
+		if(i == 0u) errors = framer.statistics().errors;
+	}
+	return (framer.statistics().errors == errors) ? AckTracker::Result::ACK : AckTracker::Result::NAK;
 }
 
 // void M9N::transmit(UBX::CFG::VAL::GET get){
@@ -59,6 +370,19 @@ void M9N::transmit(UBX::CFG::VAL::SET set){
 
 inline void M9N::delay(uint32_t delay){ HAL_Delay(delay); }
 
+/**
+ * @brief Waits until everything queued for transmission has left the UART, processing received data meanwhile.
+ */
+bool M9N::drain(uint32_t timeout){
+	const auto tik = HAL_GetTick();
+	while(!uart.tx.drained()){
+		if(HAL_GetTick() - tik >= timeout) return false;
+		delay(1u);
+		scanMessages();
+	}
+	return true;
+}
+
 void M9N::setBaudrate(Baud baud, PortID portId){
 	switch (portId){
 		case PortID::UART1:
@@ -75,145 +399,92 @@ void M9N::setBaudrate(Baud baud, PortID portId){
 	}
 }
 
+/**
+ * @brief Scans and interprets all complete messages currently received.
+ * 
+ * @note Frames are identified in place in the Rx ring by the resumable framer, which examines each received character
+ * 		 once across calls. Only a frame that wraps around the end of the ring is copied, into the bounded linearBuff.
+ */
 void M9N::scanMessages(){
-	std::pair<uint8_t *, uint16_t> s;	// {array, size}
-	s.second =  uart.rx.offloadBuff.tail;
-	if(s.second == 0) return;	// Nothing to do
-	uint8_t buffCopy[s.second];
-	s.first = buffCopy;
-
-	// The later processing will take a while. Pay copy expense in return for flushing the buffer ASAP.
-	uart.interruptsOff();
-	std::copy(uart.rx.offloadBuff.buff, uart.rx.offloadBuff.buff + s.second, s.first);
-	uart.rx.offloadBuff.tail = 0;
-	uart.interruptsOn();
-
-	uint16_t lenD = std::count_if(s.first, s.first + s.second, [](uint8_t c) -> bool{ return c == '$'; });
-	uint16_t lenL = std::count_if(s.first, s.first + s.second, [](uint8_t c) -> bool{ return c == '\r'; });
-	uint16_t lenU = std::count_if(s.first, s.first + s.second, [](uint8_t c) -> bool{ return c == 0xB5; });
-	uint16_t dollars[(lenD > 0) ? lenD : 1u];	// Will crash if zero-sized.
-	uint16_t lfcrs	[(lenL > 0) ? lenL : 1u];	// Will crash if zero-sized.
-	uint16_t mus	[(lenU > 0) ? lenU : 1u];	// Will crash if zero-sized.
-	std::pair<uint16_t*, uint16_t> d = {dollars	, 0u};	// {array, working index}
-	std::pair<uint16_t*, uint16_t> l = {lfcrs	, 0u};	// {array, working index}
-	std::pair<uint16_t*, uint16_t> u = {mus		, 0u};	// {array, working index}
-
-	for(uint16_t i = 0; i < s.second - 1; i++){
-		switch(s.first[i]){
-			case '$': {
-				d.first[d.second++] = i;
-				break;
-			}
-			case '\r':{
-				if(s.first[i+1] == '\n'){
-					l.first[l.second++] = i;
-				}
-				break;
-			} 
-			case 0xB5: {
-				if(s.first[i+1] == 0x62){
-					u.first[u.second++] = i;
-				}
-				break;
-			}
-			default: continue;
-		}
-	}
+	acks.service(HAL_GetTick());
 
-	/* UBX Frame Identification */
-	// Drop any "μb" indicies which are too close to the end of v such that the length specifier is not received.
-	for(auto i = u.second - 1; (u.second > 1u) && (i >= 0); i-- ){
-		if(u.first[i] > (s.second - 5)) lenU--;
-		else break;
+	const auto v = uart.rx.peek();
+	if(uart.rx.resync()){	// The DMA controller lapped the unread data. Resume framing with the next data received.
+		framer.reset();
+		return;
 	}
+	if(v.empty()) return;	// Nothing to do
 
-	// Construct pairs of UBX indicies and the length of that frame.
-	std::pair<uint16_t, uint16_t> ubxRanges[lenU];	// {Start, Length}
-
-	for(uint16_t i = 0u; i < lenU; i++){
-		// ubxRanges[i] = { u.first[i], UBX::getPayloadLen(std::vector<uint8_t>(s.first + u.first[i], s.first + u.first[i] + 6)) + 8 };	// +6 safe because of prior filter.
-	}
+	Framer::Frame f;
+	while(framer.next(v, f)){
+		auto frame = v.sub(f.begin, f.size).linear(linearBuff.data(), linearBuff.size());
+		if(frame.empty()) continue;
 
-	// Filter pairs for which the entire frame is not within v.
-	// This will also happen to erase pairs with a corrupted and had a large length specifier.
-	for(size_t i = 0; (lenU > 0) && (i < lenU); i++) if(ubxRanges[i].first + ubxRanges[i].second > s.second) lenU--;
-
-
-	// TODO: Scan UBX Frames
-
-
-	/* NMEA Sentence Identification */
-	// Construct pairs of alternating dollar and lfcr characters.
-	// Filter non-alternating sequences of dollar and lfcr indecies.
-	size_t lenR = (d.second > l.second) ? d.second : l.second;
-	std::pair<uint16_t, uint16_t> nmeaRanges[lenR]; // {begin, end}[]
-	lenD = d.second;
-	lenL = l.second;
-	d.second = l.second = 0u;
-	uint16_t k = 0u;
-	while( (d.second < lenD) && (l.second <lenL) ){
-		if(d.first[d.second] > l.first[l.second]){	// Discard LFCR index if no dollar index is less than the pending lfcr index.
-			l.second++;
-		}
-		else{	// Guaranteed that lfcr[j] > dollar[i]. lfcr[j] is asserted as a valid end index.
-			nmeaRanges[k++] = {d.first[d.second++], l.first[l.second++] + 2};
-
-			// Discard current dollar start index if there is a later dollar index that is also less than the end index.
-			while((d.second < lenD) && (d.first[d.second] < nmeaRanges[k-1].second) ) {
-				nmeaRanges[k-1].first = d.first[d.second++];
-			}
+		switch(f.protocol){
+			case Framer::Protocol::NMEA: interpretNmea(frame); break;
+			case Framer::Protocol::UBX:	 interpretUBX({(const uint8_t *)frame.begin(), (const uint8_t *)frame.end()}); break;
+			default: break;
 		}
 	}
 
-	/* Scan NMEA Frames */
-	for(uint16_t i = 0; i < k; i++){
-		interpretNmea(StaticString(s.first + nmeaRanges[i].first, s.first + nmeaRanges[i].second));
-		// __NOP();
-	}
-
-	/* Push remainder characters back to Rx */
-	auto lastUBX  = (lenU > 0) ? ubxRanges[lenU].first + ubxRanges[lenU].second : 0;
-	auto lastNmea = (k > 0) ? nmeaRanges[k-1].second + 2 : 0;
-	auto lastC = (lastUBX > lastNmea) ? lastUBX : lastNmea;
-
-	// If nothing was processed, or if all was processed, do nothing.
-	if( (lastC == 0) || (lastC = s.second) ) return;
-	// Add any characters that may have been received during the above processing.
-	else if(uart.rx.offloadBuff.tail > 0){	// More characters have been added during this function's call.
-		if(s.second + uart.rx.offloadBuff.tail > uart.rx.offloadBuff.size ) return;	// Buffer will overflow. Flush these remaining characters
-		else{
-			uart.interruptsOff();
-			std::copy(uart.rx.offloadBuff.buff, uart.rx.offloadBuff.buff + uart.rx.offloadBuff.tail, s.first + lastC);
-			s.second += uart.rx.offloadBuff.tail;
-			std::copy(s.first + lastC, s.first + s.second, uart.rx.offloadBuff.buff);
-			uart.rx.offloadBuff.tail = lastC;
-			uart.interruptsOn();
-		}
-	}
-	else{	// No characters were added. Copy directly into the buffer
-		uart.interruptsOff();
-		std::copy(s.first + lastC, s.first + s.second, uart.rx.offloadBuff.buff);
-		uart.rx.offloadBuff.tail = s.second;
-		uart.interruptsOn();
-	}
+	/* Release processed characters from Rx */
+	// Characters of a partial frame are kept in the ring and resumed upon with the next call.
+	uart.rx.consume(framer.release());
 }
 
 inline void M9N::interpretNmea(const StaticString & s){	
 	auto message = M9N_Base::NMEA_PUBX::getMessage(s);
+	if(message == M9N_Base::NMEA_PUBX::Message::UNKNOWN) return;
+
+	if(message == M9N_Base::NMEA_PUBX::Message::PUBX_SVSTATUS){	// Too long to be split as a Sentence.
+		const M9N_Base::NMEA_PUBX::SvStatus status{s};
+		if(sky.receive(status)) receiveGSV(sky);	// C API Call
+		return;
+	}
+
+	const NMEA_Standard::Sentence sentence{s, true};	// Verified by Framer. Split once, then shared by the message constructor.
+	if(!sentence.valid()) return;
+
 	switch(message){
 		/* Only the below cases are currently relevant. May be extended to include other cases. */
+		case M9N_Base::NMEA_PUBX::Message::PUBX_POSITION :{
+			M9N_Base::NMEA_PUBX::Position position{sentence};
+			receivePUBX(position);	// C API Call
+			return;
+		}
+		case M9N_Base::NMEA_PUBX::Message::PUBX_TIME :{
+			M9N_Base::NMEA_PUBX::Time time{sentence};
+			receivePUBX(time);	// C API Call
+			return;
+		}
+		case M9N_Base::NMEA_PUBX::Message::GGA :{
+			if(fusion.receive(NMEA_Standard::GGA{sentence})) receiveFix(fusion.current());	// C API Call upon each complete fix
+			return;
+		}
+		case M9N_Base::NMEA_PUBX::Message::RMC :{
+			if(fusion.receive(NMEA_Standard::RMC{sentence})) receiveFix(fusion.current());
+			return;
+		}
+		case M9N_Base::NMEA_PUBX::Message::VTG :{
+			if(fusion.receive(NMEA_Standard::VTG{sentence})) receiveFix(fusion.current());
+			return;
+		}
 		case M9N_Base::NMEA_PUBX::Message::GLL :{
-			NMEA_Standard::GLL gll{s};
+			NMEA_Standard::GLL gll{sentence};
 			receiveGLL(gll);	// C API Call
 			return;
 		}
 		case M9N_Base::NMEA_PUBX::Message::GSA :{
-			NMEA_Standard::GSA gsa{s};
+			NMEA_Standard::GSA gsa{sentence};
 			receiveGSA(gsa);	// C API Call
 			return;
 		}
+		case M9N_Base::NMEA_PUBX::Message::GSV :{
+			if(sky.receive(NMEA_Standard::GSV{sentence})) receiveGSV(sky);	// C API Call upon each complete group
+			return;
+		}
 		case M9N_Base::NMEA_PUBX::Message::ZDA :{
-			NMEA_Standard::ZDA zda{s};
+			NMEA_Standard::ZDA zda{sentence};
 			receiveZDA(zda);	// C API Call
 			return;
 		}
@@ -221,6 +492,31 @@ inline void M9N::interpretNmea(const StaticString & s){
 	}
 }
 
+inline void M9N::interpretUBX(std::pair<const uint8_t *, const uint8_t *> v){
+	if(v.second - v.first < 8) return;	// Frames are verified by the framer. Only the class and ID are checked here.
+
+	const auto msgClass = v.first[2], msgID = v.first[3];
+	if( (msgClass == UBX::NAV::classID) && (msgID == UBX::NAV::PVT::ID) ){
+		const UBX::NAV::PVT pvt{v.first, v.second};
+		if(pvt.valid()) receivePVT(pvt);	// C API Call
+	}
+	else if( (msgClass == UBX::CFG::classID) && (msgID == UBX::CFG::VAL::GET::ID) ){
+		const UBX::CFG::VAL::GET::POLLED polled{v.first, v.second};
+		polled.forEach([this](UBX::X4 key, UBX::U4 value){
+			if(key == CFG_UART1_BAUDRATE.toKey()) polledBaud = value;
+			shadow.store(key, value);
+		});
+	}
+	else if( (msgClass == UBX::ACKNAK::classID) && (msgID == UBX::ACKNAK::ACK::ID) ){
+		const UBX::ACKNAK::ACK ack{v.first, v.second};
+		if(ack.valid()) acks.resolve(true, ack.get(ack.ackClsID), ack.get(ack.ackMsgID));
+	}
+	else if( (msgClass == UBX::ACKNAK::classID) && (msgID == UBX::ACKNAK::NAK::ID) ){
+		const UBX::ACKNAK::NAK nak{v.first, v.second};
+		if(nak.valid()) acks.resolve(false, nak.get(nak.ackClsID), nak.get(nak.ackMsgID));
+	}
+}
+
 
 extern M9N m9n;	// To be declared in main.
 void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart){
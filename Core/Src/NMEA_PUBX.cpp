@@ -20,7 +20,7 @@
 #include "NMEA_Standard.hpp"
 
 #include <algorithm>
-#include <map>
+#include <cinttypes>
 
 M9N_Base::NMEA_PUBX::PUBX::PUBX(uint8_t msgId) :
 	NMEA_PUBX(),
@@ -48,7 +48,7 @@ M9N_Base::NMEA_PUBX::Config::Config(
 // Throws because of 8-bit port ID and 32-bit baudrate. These values will be bounded to a smaller range.
 // ! Careful modifying the format string while this warning is ignored.
 string M9N_Base::NMEA_PUBX::Config::toString(char buff[35]){
-	std::snprintf(buff, 35, "$PUBX,41,%1hu,%04hX,%04hX,%6lu,%1u*%02X\r\n",
+	std::snprintf(buff, 35, "$PUBX,41,%1hu,%04hX,%04hX,%6" PRIu32 ",%1u*%02X\r\n",
 					static_cast<uint8_t>(portId), 
 					static_cast<uint16_t>(inProto), 
 					static_cast<uint16_t>(outProto), 
@@ -59,48 +59,63 @@ string M9N_Base::NMEA_PUBX::Config::toString(char buff[35]){
 }
 #pragma GCC diagnostic pop	/* Format Truncation */
 
+/**
+ * @brief Identifies the message of a complete NMEA sentence.
+ * 
+ * @param s	The sentence, beginning with '$'.
+ * @return Message The standard sentence formatter (talker ignored), or the PUBX message ID.
+ */
 M9N_Base::NMEA_PUBX::Message M9N_Base::NMEA_PUBX::getMessage(const StaticString & s){
 	if(s.size() < 6) return Message::UNKNOWN;
 
 	auto firstDelim = std::find(s.begin(), s.end(), ',');
-	if( (firstDelim != s.end()) && (firstDelim > s.begin() + 1) ){
-		auto addr = string(s.begin() + 1, firstDelim);
-		
-		if(addr == "PUBX") addr = string(s.begin() + 1, firstDelim + 3);
-		else if(addr.size() == 5) addr = addr.substr(2);	// Drop SS from normal address.
-
-		static std::map<StaticString, Message> m{
-			{"DTM", Message::DTM},
-			{"GAQ", Message::GAQ},
-			{"GBQ", Message::GBQ},
-			{"GBS", Message::GBS},
-			{"GGA", Message::GGA},
-			{"GLL", Message::GLL},
-			{"GLQ", Message::GLQ},
-			{"GNQ", Message::GNQ},
-			{"GNS", Message::GNS},
-			{"GPQ", Message::GPQ},
-			{"GRS", Message::GRS},
-			{"GSA", Message::GSA},
-			{"GST", Message::GST},
-			{"GSV", Message::GSV},
-			{"RLM", Message::RLM},
-			{"RMC", Message::RMC},
-			{"TXT", Message::TXT},
-			{"VLW", Message::VLW},
-			{"VTG", Message::VTG},
-			{"ZDA", Message::ZDA},
-			{"PUBX,41", Message::PUBX_CONFIG},
-			{"PUBX,00", Message::PUBX_POSITION},
-			{"PUBX,03", Message::PUBX_RATE},
-			{"PUBX,03", Message::PUBX_SVSTATUS},
-			{"PUBX,04", Message::PUBX_TIME}
-		};
-
-		if(m.find(addr) == m.end()) return Message::UNKNOWN;
-		else return m[addr];
+	if(firstDelim == s.end()) return Message::UNKNOWN;
+	
+	const StaticString addr(s.begin() + 1, firstDelim);
+
+	/* Proprietary uBlox Sentences: PUBX,nn */
+	if( (addr.size() == 4) && (pack(addr.begin(), 4) == pack("PUBX")) ){
+		if(firstDelim + 2 >= s.end()) return Message::UNKNOWN;
+
+		switch(pack(firstDelim + 1, 2)){
+			case pack("41"): return Message::PUBX_CONFIG;
+			case pack("00"): return Message::PUBX_POSITION;
+			case pack("40"): return Message::PUBX_RATE;
+			case pack("03"): return Message::PUBX_SVSTATUS;
+			case pack("04"): return Message::PUBX_TIME;
+			default: return Message::UNKNOWN;
+		}
 	}
+
+	/* Standard Sentences. Drop tt from the normal ttsss address. */
+	const char * sss;
+	if(addr.size() == 5) sss = addr.begin() + 2;
+	else if(addr.size() == 3) sss = addr.begin();
 	else return Message::UNKNOWN;
+
+	switch(pack(sss, 3)){
+		case pack("DTM"): return Message::DTM;
+		case pack("GAQ"): return Message::GAQ;
+		case pack("GBQ"): return Message::GBQ;
+		case pack("GBS"): return Message::GBS;
+		case pack("GGA"): return Message::GGA;
+		case pack("GLL"): return Message::GLL;
+		case pack("GLQ"): return Message::GLQ;
+		case pack("GNQ"): return Message::GNQ;
+		case pack("GNS"): return Message::GNS;
+		case pack("GPQ"): return Message::GPQ;
+		case pack("GRS"): return Message::GRS;
+		case pack("GSA"): return Message::GSA;
+		case pack("GST"): return Message::GST;
+		case pack("GSV"): return Message::GSV;
+		case pack("RLM"): return Message::RLM;
+		case pack("RMC"): return Message::RMC;
+		case pack("TXT"): return Message::TXT;
+		case pack("VLW"): return Message::VLW;
+		case pack("VTG"): return Message::VTG;
+		case pack("ZDA"): return Message::ZDA;
+		default: return Message::UNKNOWN;
+	}
 }
 
 string M9N_Base::NMEA_PUBX::toString(const Message msg){
@@ -108,7 +123,7 @@ string M9N_Base::NMEA_PUBX::toString(const Message msg){
 		/* PUBX Extension Cases */
 		case Message::PUBX_CONFIG: 		return "PUBX,41";
 		case Message::PUBX_POSITION: 	return "PUBX,00";
-		case Message::PUBX_RATE: 		return "PUBX,03";
+		case Message::PUBX_RATE: 		return "PUBX,40";
 		case Message::PUBX_SVSTATUS: 	return "PUBX,03";
 		case Message::PUBX_TIME: 		return "PUBX,04";
 
@@ -167,4 +182,113 @@ string M9N_Base::NMEA_PUBX::Rate::toString(char buff[40]){
 	return string(buff);
 }
 
-/*** END OF FILE ***/
\ No newline at end of file
+/* PUBX,00 Position */
+
+M9N_Base::NMEA_PUBX::Position::NavStatus M9N_Base::NMEA_PUBX::Position::navStatus(const string & f){
+	if(f.size() != 2) return NavStatus::UNKNOWN;
+
+	switch(pack(f.begin(), 2)){
+		case pack("NF"): return NavStatus::NF;
+		case pack("DR"): return NavStatus::DR;
+		case pack("G2"): return NavStatus::G2;
+		case pack("G3"): return NavStatus::G3;
+		case pack("D2"): return NavStatus::D2;
+		case pack("D3"): return NavStatus::D3;
+		case pack("RK"): return NavStatus::RK;
+		case pack("TT"): return NavStatus::TT;
+		default: return NavStatus::UNKNOWN;
+	}
+}
+
+M9N_Base::NMEA_PUBX::Position::Position(const Sentence & fields) :
+	PUBX(0u),
+	altRef(0), hAcc(0), vAcc(0), sog(0), cog(0), vVel(0), diffAge(0.0f),
+	hdop(0u), vdop(0u), tdop(0u), numSvs(0u), dr(0u){
+							time		= fields[2];
+							lat			= Coordinate(fields[3], (!fields[4].empty() ? fields[4].at(0) : ' ') );
+							lon			= Coordinate(fields[5], (!fields[6].empty() ? fields[6].at(0) : ' ') );
+							Field::scaled(fields[7], 3u, altRef);
+							navStat		= navStatus(fields[8]);
+							Field::scaled(fields[9], 3u, hAcc);
+							Field::scaled(fields[10], 3u, vAcc);
+							Field::scaled(fields[11], 3u, sog);
+							Field::scaled(fields[12], 5u, cog);
+							Field::scaled(fields[13], 3u, vVel);
+							Field::real(fields[14], diffAge);
+							Field::scaled(fields[15], 2u, hdop);
+							Field::scaled(fields[16], 2u, vdop);
+							Field::scaled(fields[17], 2u, tdop);
+							Field::decimal(fields[18], numSvs);
+							Field::decimal(fields[20], dr);
+							cs			= fields.checksum();
+}
+
+M9N_Base::NMEA_PUBX::Position::Position(const string & nmea) :
+	Position(Sentence(nmea)){}
+
+/* PUBX,03 Satellite Status */
+
+M9N_Base::NMEA_PUBX::SvStatus::SvStatus(const string & nmea) : PUBX(3u), n(0u), count(0u), sv(){
+	const auto star = nmea.rfind('*');
+	uint8_t chk;
+	if( (star == string::npos) || (star + 3u > nmea.size()) ) return;
+	if( !Field::hex(nmea.substr(star + 1u, 2u), chk) || (chk != Checksum::checksum(nmea)) ) return;
+
+	const char * p = nmea.begin() + 1;
+	const char * const e = nmea.begin() + star;
+	const auto field = [&p, e]() -> string {
+		const char * const q = std::find(p, e, ',');
+		const string f(p, q);
+		p = (q == e) ? e : q + 1;
+		return f;
+	};
+
+	field();	// PUBX
+	field();	// 03
+	Field::decimal(field(), n);
+
+	uint8_t i = 0u;
+	for(; (i < n) && (i < capacity) && (p < e); i++){
+							Field::decimal(field(), sv[i].svid);
+		const auto status 	= field();
+							sv[i].s		= !status.empty() ? status.at(0) : '-';
+							Field::decimal(field(), sv[i].az);
+							Field::decimal(field(), sv[i].el);
+							Field::decimal(field(), sv[i].cno);
+							Field::decimal(field(), sv[i].lck);
+	}
+	count = i;
+	cs = chk;
+}
+
+/* PUBX,04 Time of Day and Clock Information */
+
+M9N_Base::NMEA_PUBX::Time::Time(const Sentence & fields) :
+	PUBX(4u),
+	utcTow(0u), utcWk(0u), leapSec(0u), leapDefault(false), clkBias(0), clkDrift(0), tpGran(0u){
+	uint8_t day = 0u, month = 0u, yy = 0u;
+	const auto date = fields[3];	// ddmmyy
+	if(date.size() == 6){
+		Field::decimal(date.substr(0, 2), day);
+		Field::decimal(date.substr(2, 2), month);
+		Field::decimal(date.substr(4, 2), yy);
+	}
+
+	auto leap = fields[6];	// "D" suffix if the firmware default.
+	leapDefault = !leap.empty() && (leap.at(leap.size() - 1) == 'D');
+	if(leapDefault) leap = leap.substr(0, leap.size() - 1);
+
+							time		= NMEA_Standard::ZDA::UTC_DateTime(fields[2], day, month, (yy != 0u) ? 2000u + yy : 0u, 0u, 0u);
+							Field::scaled(fields[4], 3u, utcTow);
+							Field::decimal(fields[5], utcWk);
+							Field::decimal(leap, leapSec);
+							Field::scaled(fields[7], 0u, clkBias);
+							Field::scaled(fields[8], 3u, clkDrift);
+							Field::decimal(fields[9], tpGran);
+							cs			= fields.checksum();
+}
+
+M9N_Base::NMEA_PUBX::Time::Time(const string & nmea) :
+	Time(Sentence(nmea)){}
+
+/*** END OF FILE ***/
@@ -19,40 +19,108 @@
 /* --------------------------------------------------------------------------- */
 /* Begin Private Includes */
 #include "NMEA_Standard.hpp"
+#include "CivilTime.hpp"
+#include "Scan.hpp"
 
 #include <algorithm>
+#include <cinttypes>
 #include <cstdio>
-#include <map>
-
-template<size_t N>
-std::array<string, N> NMEA_Standard::parseFields(const string & nmea){
-	std::array<string, N> fields;
-
-	size_t i = 1, n = 0;
-	if(!nmea.empty() && valid(nmea)){	// Only proceed if the NMEA sentence was valid.
-		if(nmea.at(0) == '$'){
-			std::size_t j;
-			for(j = 1; j < nmea.length(); j++){
-				if(nmea.at(j) == ','){	// Push each comma delimited item.
-					fields[n++] = nmea.substr(i, j-i); 
-					i = j+1;
-					if(n >= N) goto InvalidNoFields;
-				}
-				else if(nmea.at(j) == '*'){
-					fields[n++] = (nmea.substr(i, j-i));	// Last field before checksum
-					break;
-				}
-			}
-			if(j < nmea.length() - 3) fields[n] = (nmea.substr(j, 3));	// Checksum characters.
+
+/* NMEA Sentence Tokenizer */
+
+NMEA_Standard::Sentence::Sentence(const string & nmea) : Sentence(nmea, false) {}
+
+NMEA_Standard::Sentence::Sentence(const string & nmea, bool verified) : s(nmea), n(0u), cs(0u){
+	if( (s.size() < 4) || (s.size() > UINT8_MAX) || (s.at(0) != '$') ) return;
+
+	const auto p = reinterpret_cast<const uint8_t *>(s.begin());
+	uint8_t chk = 0x00u, nFields = 0u;
+	begin[0] = 1u;
+	size_t j = 1u;
+	if(verified){	// Delimiters only. The checksum is read below.
+		while( ((j += Scan::find(p + j, s.size() - j, ',', '*')) < s.size()) && (p[j] == ',') ){
+			if(++nFields < maxFields) begin[nFields] = j + 1u;
+			j++;
+		}
+	}
+	else{
+		j += Scan::split(p + 1, s.size() - 1u, ',', '*', chk, [&](size_t i){
+			if(++nFields < maxFields) begin[nFields] = i + 2u;	// i is relative to p + 1.
+		});
+	}
+	if(nFields >= maxFields) return;	// Too many fields.
+	if(j + 3 > s.size()) return;		// No "*hh".
+	begin[++nFields] = j + 1;
+
+	const auto h = Field::hexDigit(s.at(j + 1)), l = Field::hexDigit(s.at(j + 2));
+	if( (h < 0) || (l < 0) ) return;
+	if(verified) chk = (h << 4) | l;
+	else if(((h << 4) | l) != chk) return;
+
+	cs = chk;
+	n = nFields;
+}
+
+/* NMEA Field Decoders */
+
+int8_t NMEA_Standard::Field::hexDigit(char c){
+	if( (c >= '0') && (c <= '9') ) return c - '0';
+	else if( (c >= 'A') && (c <= 'F') ) return c - 'A' + 10;
+	else if( (c >= 'a') && (c <= 'f') ) return c - 'a' + 10;
+	else return -1;
+}
+
+/**
+ * @brief Decodes a decimal number as an integer mantissa and a power of ten divisor.
+ * 
+ * @param f			The field.
+ * @param mantissa	Set to the digits of the number, including its sign.
+ * @param decimals	Set to the number of fractional digits in the mantissa.
+ * @return true if the field was a number. Fractional digits beyond the range of the mantissa are truncated.
+ */
+bool NMEA_Standard::Field::fixed(const string & f, int32_t & mantissa, uint8_t & decimals){
+	auto i = f.begin();
+	const bool negative = (i != f.end()) && (*i == '-');
+	if( (i != f.end()) && ( (*i == '-') || (*i == '+') ) ) i++;
+
+	int32_t m = 0;
+	uint8_t d = 0u;
+	bool point = false, any = false;
+	for(; i != f.end(); i++){
+		if(*i == '.'){
+			if(point) return false;
+			point = true;
+			continue;
+		}
+
+		const auto x = digit(*i);
+		if(x < 0) return false;
+		any = true;
+
+		if( (m > (INT32_MAX - x) / 10) || (point && (d >= maxDigits)) ){
+			if(point) continue;		// Excess fractional precision.
+			else return false;		// Integer part out of range.
 		}
+		m = m * 10 + x;
+		if(point) d++;
 	}
-	return fields;
+	if(!any) return false;
 
-InvalidNoFields:
-	for(auto k = 0u; ++k < N; ) fields[k] = "";
-	return fields;
+	mantissa = negative ? -m : m;
+	decimals = d;
+	return true;
 }
 
+const int32_t NMEA_Standard::Field::pow10[maxDigits + 1] = 
+	{1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+bool NMEA_Standard::Field::real(const string & f, float & v){
+	int32_t m;
+	uint8_t d;
+	if(!fixed(f, m, d)) return false;
+	v = static_cast<float>(m) / static_cast<float>(pow10[d]);
+	return true;
+}
 
 /* NMEA Address Methods */
 
@@ -83,8 +151,8 @@ string NMEA_Standard::Address::toString(char buff[5]){
 
 /* NMEA Checksum Methods */
 
-NMEA_Standard::Checksum::Checksum(const string & s){
-	std::sscanf(s.c_str(), "*%2hhX", &cs);
+NMEA_Standard::Checksum::Checksum(const string & s) : cs(0u){
+	if( (s.size() >= 3) && (s.at(0) == ast) ) Field::hex(s.substr(1, 2), cs);
 }
 
 NMEA_Standard::Checksum::Checksum(uint8_t c){
@@ -92,31 +160,21 @@ NMEA_Standard::Checksum::Checksum(uint8_t c){
 }
 
 bool NMEA_Standard::Checksum::valid(const string & nmea){
-	auto astI = nmea.rfind('*');
-
-	if(nmea.empty() || astI == string::npos) return false;
-
-	uint8_t givenC = 0;
-	auto nConv = std::sscanf(nmea.substr(astI, 5).c_str(), "*%2hX\r\n", (uint16_t *)&givenC);
-		// In sscanf using "*%2hhX\r\n" should have been appropriate for a uint8_t value but this formatter triggered reading
-		// the checksum as a decimal number. This appears to be a legitimate bug with the compiler.
-		// The above using the type cast remains safe because %2 guarantees the value will fit within givenC.
-	if(nConv != 1) return false;	// Scan failed.
-	else return givenC == checksum(nmea);
+	return Sentence(nmea).valid();	// Verified in the same pass which splits the fields.
 }
 
 uint8_t NMEA_Standard::Checksum::checksum(const string & nmea){
-	uint8_t chk = 0x00u;
-	for(auto & c : nmea){
-		if(c == '$') continue;
-		else if (c == '*') break;
-		else chk ^= c;
-	}
+	const auto p = reinterpret_cast<const uint8_t *>(nmea.begin());
+	const size_t first = (!nmea.empty() && (nmea.at(0) == '$')) ? 1u : 0u;
+
+	uint8_t chk;
+	Scan::split(p + first, nmea.size() - first, ',', '*', chk, [](size_t){});
 	return chk;
 }
 
 void NMEA_Standard::setChecksum(){
-	cs.cs = Checksum::checksum(this->toString(nullptr));
+	char buff[83];	// Maximum NMEA sentence length, plus the null character.
+	cs.cs = Checksum::checksum(this->toString(buff));
 }
 
 const string NMEA_Standard::toString(const Message msg){
@@ -160,47 +218,43 @@ const string NMEA_Standard::toString(const TalkerID tId){
 NMEA_Standard::Message NMEA_Standard::getMessage(const StaticString & s){
 	if(s.size() != 3) return Message::UNKNOWN;
 
-	static std::map<StaticString, Message> m{
-		{"DTM", Message::DTM},
-		{"GAQ", Message::GAQ},
-		{"GBQ", Message::GBQ},
-		{"GBS", Message::GBS},
-		{"GGA", Message::GGA},
-		{"GLL", Message::GLL},
-		{"GLQ", Message::GLQ},
-		{"GNQ", Message::GNQ},
-		{"GNS", Message::GNS},
-		{"GPQ", Message::GPQ},
-		{"GRS", Message::GRS},
-		{"GSA", Message::GSA},
-		{"GST", Message::GST},
-		{"GSV", Message::GSV},
-		{"RLM", Message::RLM},
-		{"RMC", Message::RMC},
-		{"TXT", Message::TXT},
-		{"VLW", Message::VLW},
-		{"VTG", Message::VTG},
-		{"ZDA", Message::ZDA},
-	};
-
-	if(m.find(s) == m.end()) return Message::UNKNOWN;
-	else return m[s];
+	switch(pack(s.begin(), 3)){
+		case pack("DTM"): return Message::DTM;
+		case pack("GAQ"): return Message::GAQ;
+		case pack("GBQ"): return Message::GBQ;
+		case pack("GBS"): return Message::GBS;
+		case pack("GGA"): return Message::GGA;
+		case pack("GLL"): return Message::GLL;
+		case pack("GLQ"): return Message::GLQ;
+		case pack("GNQ"): return Message::GNQ;
+		case pack("GNS"): return Message::GNS;
+		case pack("GPQ"): return Message::GPQ;
+		case pack("GRS"): return Message::GRS;
+		case pack("GSA"): return Message::GSA;
+		case pack("GST"): return Message::GST;
+		case pack("GSV"): return Message::GSV;
+		case pack("RLM"): return Message::RLM;
+		case pack("RMC"): return Message::RMC;
+		case pack("TXT"): return Message::TXT;
+		case pack("VLW"): return Message::VLW;
+		case pack("VTG"): return Message::VTG;
+		case pack("ZDA"): return Message::ZDA;
+		default: return Message::UNKNOWN;
+	}
 }
 
 NMEA_Standard::TalkerID NMEA_Standard::getTalkerId(const StaticString & s){
 	if(s.size() != 2) return TalkerID::UNKNOWN;
 
-	static std::map<StaticString, TalkerID> m{
-		{"GP", TalkerID::GP},
-		{"GL", TalkerID::GL},
-		{"GA", TalkerID::GA},
-		{"GB", TalkerID::GB},
-		{"GQ", TalkerID::GQ},
-		{"GN", TalkerID::GN}
-	};
-
-	if(m.find(s) == m.end()) return TalkerID::UNKNOWN;
-	else return m[s];
+	switch(pack(s.begin(), 2)){
+		case pack("GP"): return TalkerID::GP;
+		case pack("GL"): return TalkerID::GL;
+		case pack("GA"): return TalkerID::GA;
+		case pack("GB"): return TalkerID::GB;
+		case pack("GQ"): return TalkerID::GQ;
+		case pack("GN"): return TalkerID::GN;
+		default: return TalkerID::UNKNOWN;
+	}
 }
 
 
@@ -212,69 +266,90 @@ string NMEA_Standard::Checksum::toString(char cStr[4]){
 
 /* NMEA UTC Time Methods */
 
-NMEA_Standard::UTC_Time::UTC_Time(const string & tStr){
-	std::sscanf(tStr.c_str(), "%2hu%2hu%5f", (uint16_t*)&hh, (uint16_t*)&mm, &ss);
+NMEA_Standard::UTC_Time::UTC_Time(const string & tStr) : hh(0u), mm(0u), ss(0u), ms(0u){
+	if(tStr.size() < 6) return;	// hhmmss[.ss]
+	Field::decimal(tStr.substr(0, 2), hh);
+	Field::decimal(tStr.substr(2, 2), mm);
+	Field::decimal(tStr.substr(4, 2), ss);
+	if( (tStr.size() > 7) && (tStr.at(6) == '.') ) Field::scaled(tStr.substr(6), 3u, ms);
 }
 
-time_t NMEA_Standard::UTC_Time::daytime() const{
-	return (hh * 60 + mm) * 60 * 1000 + ss * 1000;
+uint32_t NMEA_Standard::UTC_Time::daytime() const{
+	return ( (hh * 60u + mm) * 60u + ss ) * 1000u + ms;
 }
 
 /*  NMEA Coordinate Methods */
 
-NMEA_Standard::Coordinate::Coordinate(const string & s, char nsew) : nsew(nsew){
+NMEA_Standard::Coordinate::Coordinate(const string & s, char nsew) : deg7(0){
 	auto const decI = s.find('.');
 	if(
 		(decI != string::npos) &&
 		(s.length() >= 6) &&
 		(decI > 3)
 	){
-		char fmt[8];
-		std::snprintf(fmt, 8, "%%%1dhd%%8f", decI-2);
-		std::sscanf(s.c_str(), fmt, &deg, &min);
+		// (d)ddmm.mmmm: Minutes always take the two integer digits before the decimal point.
+		uint8_t deg = 0u;
+		int32_t min7 = 0;	// Minutes x 1e7. At most 6e8.
+		if( !Field::decimal(s.substr(0, decI - 2), deg) || !Field::scaled(s.substr(decI - 2), 7u, min7) ) return;
+
+		deg7 = deg * 10000000 + (min7 + 30) / 60;
+		if( (nsew == 'S') || (nsew == 'W') ) deg7 = -deg7;
 	}
 }
 
 string NMEA_Standard::Coordinate::toString(char cStr[12]){
-	auto nConv = std::snprintf(cStr, 12, "%3d%8.4f", deg, min);
-	return (nConv == 2) ? string(cStr) : "";
-}
-
-/**
- * @brief Assignes the Coordinate in terms of fractional degrees.
- * 
- * @param c	The Coordinate being assigned.
- * @return float The Coordinate in fractional degrees.
- */
-NMEA_Standard::Coordinate::operator float() const{
-	return (static_cast<float>(deg)*60 + min) * (( nsew == 'S') || (nsew == 'W') ? -1.0 : 1.0);
+	const uint32_t a = (deg7 < 0) ? -static_cast<uint32_t>(deg7) : deg7;
+	const uint32_t min4 = (a % 10000000u) * 6u / 100u;	// Minutes x 1e4
+	auto nConv = std::snprintf(cStr, 12, "%3" PRIu32 "%02" PRIu32 ".%04" PRIu32, a / 10000000u, min4 / 10000u, min4 % 10000u);
+	return (nConv > 0) ? string(cStr, nConv) : "";
 }
 
 /* NMEA GNS Message */
-extern unsigned long strtoul(const char *, char ** = nullptr, int = 10);
-NMEA_Standard::GNS::GNS(const std::array<StaticString, 15> & fields){
+
+NMEA_Standard::GNS::GNS(const Sentence & fields){
 		// Class constructors will handle empty cases.
 							addr 		= fields[0];
 							time		= fields[1];
 							lat			= Coordinate(fields[2], (!fields[3].empty() ? fields[3].at(0) : ' ') );
 							lon			= Coordinate(fields[4], (!fields[5].empty() ? fields[5].at(0) : ' ') );
 							posMode		= fields[6];
-	if(!fields[7].empty())	numSV		= std::strtoul(fields[7].c_str(), nullptr, 10);
-	if(!fields[8].empty())	hdop		= std::strtof(fields[8].c_str(), nullptr);
-	if(!fields[9].empty())	alt			= std::strtof(fields[9].c_str(), nullptr);
-	if(!fields[10].empty())	sep			= std::strtof(fields[10].c_str(), nullptr);
-	if(!fields[11].empty())	diffAge		= std::strtof(fields[11].c_str(), nullptr);
-	if(!fields[12].empty())	diffStation	= std::strtoul(fields[12].c_str(), nullptr, 10);
+							Field::decimal(fields[7], numSV);
+							Field::scaled(fields[8], 2u, hdop);
+							Field::scaled(fields[9], 3u, alt);
+							Field::scaled(fields[10], 3u, sep);
+							Field::real(fields[11], diffAge);
+							Field::decimal(fields[12], diffStation);
 	if(!fields[13].empty()) navStatus 	= fields[13].at(0);
-							cs			= fields[14];
+							cs			= fields.checksum();
 }
 
 NMEA_Standard::GNS::GNS(const string & msg) :
-	GNS(parseFields<15>(msg)){}
+	GNS(Sentence(msg)){}
+
+/* NMEA GGA Message */
+
+NMEA_Standard::GGA::GGA(const Sentence & fields) : 
+	quality(0u), numSV(0u), hdop(0u), alt(0), sep(0), diffAge(0.0f), diffStation(0u){
+							addr		= fields[0];
+							time		= fields[1];
+							lat			= Coordinate(fields[2], (!fields[3].empty() ? fields[3].at(0) : ' ') );
+							lon			= Coordinate(fields[4], (!fields[5].empty() ? fields[5].at(0) : ' ') );
+							Field::decimal(fields[6], quality);
+							Field::decimal(fields[7], numSV);
+							Field::scaled(fields[8], 2u, hdop);
+							Field::scaled(fields[9], 3u, alt);
+							Field::scaled(fields[11], 3u, sep);
+							Field::real(fields[13], diffAge);
+							Field::decimal(fields[14], diffStation);
+							cs			= fields.checksum();
+}
+
+NMEA_Standard::GGA::GGA(const string & nmea) :
+	GGA(Sentence(nmea)){}
 
 /* NMEA GLL Message */
 
-NMEA_Standard::GLL::GLL(const std::array<StaticString, 9> & fields){	
+NMEA_Standard::GLL::GLL(const Sentence & fields){
 							addr 	= fields[0];
 							lat 	= Coordinate(fields[1], (!fields[2].empty() ? fields[2].at(0) : ' '));
 							lon 	= Coordinate(fields[3], (!fields[4].empty() ? fields[4].at(0) : ' '));
@@ -283,46 +358,126 @@ NMEA_Standard::GLL::GLL(const std::array<StaticString, 9> & fields){
 	else					status	= ' ';
 	if(!fields[7].empty()) 	posMode = fields[7].at(0);
 	else					posMode	= ' ';
-							cs 		= fields[8];
+							cs 		= fields.checksum();
 }
 
 NMEA_Standard::GLL::GLL(const string & nmea):
-	GLL(parseFields<9>(nmea)){}
+	GLL(Sentence(nmea)){}
 
 /* NMEA GSA Message */
 
-NMEA_Standard::GSA::GSA(const std::array<StaticString, 20> & fields){
+NMEA_Standard::GSA::GSA(const Sentence & fields){
 							addr 		= fields[0];
 	if(!fields[1].empty())	opMode 		= fields[1].at(0);
-	if(!fields[2].empty()) 	navMode 	= std::strtoul(fields[2].c_str(), nullptr, 10);
+							Field::decimal(fields[2], navMode);
 	
 	for(int i = 0; i < 12; i++)
-							svid[i] = (!fields[3+i].empty()) ? std::strtoul(fields[3+i].c_str(), nullptr, 10) : 0u;
+		if(!Field::decimal(fields[3+i], svid[i])) svid[i] = 0u;
 	
-	if(!fields[15].empty()) pdop 		= std::strtof(fields[15].c_str(), nullptr);
-	if(!fields[16].empty()) hdop 		= std::strtof(fields[16].c_str(), nullptr);
-	if(!fields[17].empty()) vdop 		= std::strtof(fields[17].c_str(), nullptr);
-	if(!fields[18].empty()) systemId 	= std::strtoul(fields[18].c_str(), nullptr, 16);
-							cs 			= fields[19];
+							Field::scaled(fields[15], 2u, pdop);
+							Field::scaled(fields[16], 2u, hdop);
+							Field::scaled(fields[17], 2u, vdop);
+							Field::hex(fields[18], systemId);
+							cs 			= fields.checksum();
 }
 
 NMEA_Standard::GSA::GSA(const string & nmea) :
-	GSA(parseFields<20>(nmea)){}
+	GSA(Sentence(nmea)){}
+
+/* NMEA GSV Message */
+
+NMEA_Standard::GSV::GSV(const Sentence & fields) : numMsg(0u), msgNum(0u), numSV(0u), count(0u), sv(), signalId(0u){
+	// 4 fields per satellite after numSV, then the signal ID if NMEA 4.10 or later.
+	const uint8_t n = (fields.size() > 4u) ? fields.size() - 4u : 0u;
+	count = (n / 4u < perSentence) ? n / 4u : perSentence;
+
+							addr 		= fields[0];
+							Field::decimal(fields[1], numMsg);
+							Field::decimal(fields[2], msgNum);
+							Field::decimal(fields[3], numSV);
+
+	for(uint8_t i = 0; i < count; i++){
+		const uint8_t f = 4u + 4u * i;
+		Field::decimal(fields[f], sv[i].svid);
+		Field::decimal(fields[f + 1], sv[i].elv);
+		Field::decimal(fields[f + 2], sv[i].az);
+		Field::decimal(fields[f + 3], sv[i].cno);
+	}
+
+	if(n % 4u == 1u)		Field::hex(fields[fields.size() - 1u], signalId);
+							cs 			= fields.checksum();
+}
+
+NMEA_Standard::GSV::GSV(const string & nmea) :
+	GSV(Sentence(nmea)){}
+
+/* NMEA RMC Message */
+
+NMEA_Standard::RMC::RMC(const Sentence & fields) : spd(0), cog(0), mv(0){
+	uint8_t day = 0u, month = 0u, yy = 0u;
+	const auto date = fields[9];	// ddmmyy
+	if(date.size() == 6){
+		Field::decimal(date.substr(0, 2), day);
+		Field::decimal(date.substr(2, 2), month);
+		Field::decimal(date.substr(4, 2), yy);
+	}
+
+							addr		= fields[0];
+							time		= ZDA::UTC_DateTime(fields[1], day, month, (yy != 0u) ? 2000u + yy : 0u, 0u, 0u);
+	if(!fields[2].empty())	status		= fields[2].at(0);
+	else					status		= 'V';
+							lat			= Coordinate(fields[3], (!fields[4].empty() ? fields[4].at(0) : ' ') );
+							lon			= Coordinate(fields[5], (!fields[6].empty() ? fields[6].at(0) : ' ') );
+							Field::scaled(fields[7], 3u, spd);
+							Field::scaled(fields[8], 5u, cog);
+							Field::scaled(fields[10], 5u, mv);
+	if(!fields[11].empty())	mvEW		= fields[11].at(0);
+	else					mvEW		= ' ';
+	if(!fields[12].empty())	posMode		= fields[12].at(0);
+	else					posMode		= 'N';
+	if(!fields[13].empty())	navStatus	= fields[13].at(0);
+	else					navStatus	= ' ';
+							cs			= fields.checksum();
+}
+
+NMEA_Standard::RMC::RMC(const string & nmea) :
+	RMC(Sentence(nmea)){}
+
+/* NMEA VTG Message */
+
+NMEA_Standard::VTG::VTG(const Sentence & fields) : cogt(0), cogm(0), sogn(0), sogk(0){
+							addr		= fields[0];
+							Field::scaled(fields[1], 5u, cogt);
+							Field::scaled(fields[3], 5u, cogm);
+							Field::scaled(fields[5], 3u, sogn);
+							Field::scaled(fields[7], 3u, sogk);
+	if(!fields[9].empty())	posMode		= fields[9].at(0);
+	else					posMode		= 'N';
+							cs			= fields.checksum();
+}
+
+NMEA_Standard::VTG::VTG(const string & nmea) :
+	VTG(Sentence(nmea)){}
 
 /* NMEA ZDA Message */
 
 
-NMEA_Standard::ZDA::ZDA(const std::array<StaticString, 9> & fields){
+NMEA_Standard::ZDA::ZDA(const Sentence & fields){
+	uint8_t day = 0u, month = 0u, ltzh = 0u, ltzm = 0u;
+	uint16_t year = 0u;
+	Field::decimal(fields[2], day);
+	Field::decimal(fields[3], month);
+	Field::decimal(fields[4], year);
+	Field::decimal(fields[5], ltzh);
+	Field::decimal(fields[6], ltzm);
+
 	addr		= fields[0];
-	time		= UTC_DateTime(
-					fields[1],
-					std::strtoul(fields[2].c_str(), nullptr, 10), std::strtoul(fields[3].c_str(), nullptr, 10), std::strtoul(fields[4].c_str(), nullptr, 10),
-					std::strtoul(fields[5].c_str(), nullptr, 10), std::strtoul(fields[6].c_str(), nullptr, 10) );
-	cs			= fields[7];
+	time		= UTC_DateTime(fields[1], day, month, year, ltzh, ltzm);
+	cs			= fields.checksum();
 }
 
 NMEA_Standard::ZDA::ZDA(const string & nmea) :
-	ZDA(parseFields<9>(nmea)){}
+	ZDA(Sentence(nmea)){}
 
 
 NMEA_Standard::ZDA::UTC_DateTime::UTC_DateTime(const string & time, 
@@ -333,20 +488,15 @@ NMEA_Standard::ZDA::UTC_DateTime::UTC_DateTime(const string & time,
 	ltzh(ltzh), ltzm(ltzm) {}
 
 time_t NMEA_Standard::ZDA::UTC_DateTime::epoch() const {
-	struct tm date{
-		.tm_sec 	= static_cast<int>(ss),
-		.tm_min 	= mm,
-		.tm_hour 	= hh,
-		.tm_mday 	= day,
-		.tm_mon 	= month,
-		.tm_year 	= year - 1990,
-		.tm_isdst = -1
-	};
-	return mktime(&date);
+	return static_cast<time_t>( CivilTime::epoch(year, month, day, hh, mm, ss) );
+}
+
+int64_t NMEA_Standard::ZDA::UTC_DateTime::epochMs() const {
+	return CivilTime::epochMs(year, month, day, daytime());
 }
 
 time_t NMEA_Standard::ZDA::UTC_DateTime::midnight() const{
-	return epoch() - daytime();
+	return static_cast<time_t>( CivilTime::epoch(year, month, day, 0u, 0u, 0u) );
 }
 
 inline NMEA_Standard::ZDA::UTC_DateTime::operator time_t() const{ return epoch(); }
@@ -0,0 +1,119 @@
+/**
+  ******************************************************************************
+  * @file			: SatelliteTable.cpp
+  * @brief			: Source for SatelliteTable.hpp
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+#include "SatelliteTable.hpp"
+
+/**
+ * @brief Adds a GSV sentence to the group being assembled.
+ *
+ * @note The first sentence of a group abandons any group left incomplete.
+ */
+bool SatelliteTable::receive(const NMEA_Standard::GSV & gsv){
+	if( (gsv.msgNum == 0u) || (gsv.msgNum > gsv.numMsg) ) return false;
+
+	if(gsv.msgNum == 1u) begin(gsv);
+	else if( (gsv.msgNum != next) || (gsv.numMsg != numMsg) || (gsv.addr.tt != talker) || (gsv.signalId != signalId) ){
+		next = 0u;	// Out of sequence. Discard the group.
+		return false;
+	}
+
+	Table & back = tables[front ^ 1u];
+	for(uint8_t i = 0; (i < gsv.count) && (back.count < capacity); i++){
+		const uint8_t r = back.count++;
+		back.talker[r]		= talker;
+		back.svid[r]		= gsv.sv[i].svid;
+		back.elevation[r]	= gsv.sv[i].elv;
+		back.azimuth[r]		= gsv.sv[i].az;
+		back.cno[r]			= gsv.sv[i].cno;
+		back.signalId[r]	= signalId;
+	}
+
+	if(gsv.msgNum < numMsg){
+		next = gsv.msgNum + 1u;
+		return false;
+	}
+
+	next = 0u;
+	front ^= 1u;	// Publish. A single byte write.
+	return true;
+}
+
+bool SatelliteTable::receive(const M9N_Base::NMEA_PUBX::SvStatus & status){
+	if(status.count == 0u) return false;
+
+	next = 0u;	// Abandons any GSV group.
+	Table & back = tables[front ^ 1u];
+	back.count = 0u;
+	for(uint8_t i = 0; (i < status.count) && (i < capacity); i++){
+		const uint8_t r = back.count++;
+		back.talker[r]		= NMEA_Standard::TalkerID::GN;
+		back.svid[r]		= status.sv[i].svid;
+		back.elevation[r]	= status.sv[i].el;
+		back.azimuth[r]		= status.sv[i].az;
+		back.cno[r]			= status.sv[i].cno;
+		back.signalId[r]	= 0u;
+	}
+
+	front ^= 1u;
+	return true;
+}
+
+/**
+ * @brief Starts a group in the back table with the current rows of every other talker and signal.
+ */
+void SatelliteTable::begin(const NMEA_Standard::GSV & gsv){
+	talker = gsv.addr.tt;
+	signalId = gsv.signalId;
+	numMsg = gsv.numMsg;
+
+	const Table & cur = tables[front];
+	Table & back = tables[front ^ 1u];
+	back.count = 0u;
+	for(uint8_t i = 0; i < cur.count; i++){
+		if( (cur.talker[i] == talker) && (cur.signalId[i] == signalId) ) continue;	// Replaced by this group.
+
+		const uint8_t r = back.count++;
+		back.talker[r]		= cur.talker[i];
+		back.svid[r]		= cur.svid[i];
+		back.elevation[r]	= cur.elevation[i];
+		back.azimuth[r]		= cur.azimuth[i];
+		back.cno[r]			= cur.cno[i];
+		back.signalId[r]	= cur.signalId[i];
+	}
+}
+
+void SatelliteTable::clear(){
+	next = 0u;
+	tables[front ^ 1u].count = 0u;
+	front ^= 1u;
+}
+
+SatelliteTable::Summary SatelliteTable::summary() const{
+	const Table & t = current();
+	uint8_t tracked = 0u, maxCno = 0u;
+	uint16_t sum = 0u;
+	for(uint8_t i = 0; i < t.count; i++){
+		const uint8_t c = t.cno[i];
+		tracked += (c != 0u);
+		sum += c;
+		maxCno = (c > maxCno) ? c : maxCno;
+	}
+	return {t.count, tracked, maxCno, static_cast<uint8_t>( (tracked != 0u) ? sum / tracked : 0u )};
+}
+
+/*** END OF FILE ***/
@@ -40,70 +40,262 @@ void UART::Tx::transmit(const StaticString & msg){
 	auto p = alloc(msg.size());
 	if(p){
 		std::copy(msg.begin(), msg.end(), p);
-		transmit(msg.size());
-		nextTransmission();	// Will start transmission if idle. Else message will be sent later.
+		transmit(msg.size());	// Will start transmission if idle. Else message will be sent later.
 	}
 }
 
+/**
+ * @brief Allocates size contiguous characters, waiting for transmissions to free space if necessary.
+ * 
+ * @return uint8_t* nullptr if size can never fit or no space was freed within the timeout.
+ */
 uint8_t * UART::Tx::alloc(uint16_t size) noexcept {
-	if(size > (buffSize)) return nullptr;
-	
-	uint16_t free;
-	if(alHead >= tail){								// Allocation has not looped.
-		free = buff.end() - alHead;
-		if(free >= size){							// Can allocate in front of current allocation.
-			auto p = const_cast<uint8_t *>(alHead);
+	if( (size == 0u) || (size >= buffSize) ) return nullptr;
+
+	const auto tik = HAL_GetTick();		// Save time for timeout detection.
+	do{
+		auto p = tryAlloc(size);
+		if(p) return p;
+
+		if(!txBusy()) nextTransmission();	// Ensure that anything scheduled is freeing memory.
+		HAL_Delay(delayTime);
+	} while(HAL_GetTick() - tik < timeout);
+	return nullptr;	// Timed out
+}
+
+/**
+ * @brief Allocates size contiguous characters if they are free now.
+ * 
+ * @return uint8_t* nullptr if size does not fit until more has been transmitted, or never fits.
+ * 
+ * @note Allocations are contiguous. One that does not fit before the end of the buffer is placed at the beginning.
+ * 		 One character is always kept free, so alHead only equals tail once everything allocated has been
+ * 		 transmitted.
+ * @note Also fails while the descriptor or notification queue is full, so that the following submit() can always
+ * 		 be queued and tracked.
+ */
+uint8_t * UART::Tx::tryAlloc(uint16_t size) noexcept {
+	if( (size == 0u) || (size >= buffSize) ) return nullptr;
+	if( (queue(Lane::COMMAND).free() == 0u) || queue(Lane::COMMAND).notifyFull() ) return nullptr;
+
+	auto t = const_cast<uint8_t *>(tail);
+	if(alHead == t){	// Empty, though data held in place may be transmitting. Restart at the beginning so that the whole buffer is available.
+		tail = alHead = buff.begin();
+		t = buff.begin();
+	}
+
+	if(alHead >= t){								// Allocation has not looped.
+		if(buff.end() - alHead >= size){			// Can allocate in front of current allocation.
+			alLast = alHead;
 			alHead += size;
-			lpHead = alHead;	// Save this as the new maximum head before looping.
-			return p;
-		} 
-		else{								// Must loop to beginning of buffer.
-			alHead = buff.begin();			// Reset the allocation pointer.
-			goto PreTailAllocation;
+			return alLast;
+		}
+		else if(t - buff.begin() > size){			// Can loop to the beginning of the buffer.
+			alLast = buff.begin();
+			alHead = buff.begin() + size;
+			return alLast;
 		}
 	}
-	else{								// Allocation is to be before tail.
-PreTailAllocation:
-		auto tik = HAL_GetTick();		// Save time for timeout detection.
-		do{
-				free = tail - buff.begin();
-				if(free >= size){				// Can allocate before tail.
-					auto p = alHead;
-					alHead += size;				// Loop head
-					return p;
-				}
-				else if(txBusy()){				// Transmission should free memory soon.
-					HAL_Delay(delayTime);
-				}
-				else return nullptr;			// Tx not active therefore no memory will be freed anytime soon.
-		} while(HAL_GetTick() - tik < timeout);
-		return nullptr;	// Timed out
+	else if(t - alHead > size){						// Can allocate before tail.
+		alLast = alHead;
+		alHead += size;
+		return alLast;
 	}
+	return nullptr;
 }
 
+/**
+ * @brief Schedules the first n characters of the latest allocation, releasing any remainder of it.
+ */
 void UART::Tx::transmit(uint16_t n){
-	scHead += n;
-	if(scHead > lpHead)	scHead = buff.begin() + n;	// Allocation has looped
-	if(scHead > lpHead) scHead = lpHead;			// Erroneous condition. Only schedule remainder before the looping head.
+	submit(n);
+}
+
+/**
+ * @brief Schedules the first n characters of the latest allocation, releasing any remainder of it.
+ * 
+ * @param done	Called from the Tx complete interrupt once the n characters have been transmitted. May be nullptr.
+ * @return Token Identifies the message to sent(). wouldBlock if n is 0, in which case done is not called.
+ */
+UART::Tx::Token UART::Tx::submit(uint16_t n, Notify done, void * ctx){
+	alHead = alLast + n;
+	if(n == 0u) return wouldBlock;
+
+	const Token t = token(Lane::COMMAND, queue(Lane::COMMAND).scCount + n);
+	if(done != nullptr) track(Lane::COMMAND, t, done, ctx);
+	enqueue(Lane::COMMAND, alLast, n, true);
 
 	nextTransmission();		// Instantiate a new transmission if one is not already occuring.
+	return t;
+}
+
+/**
+ * @brief Copies and schedules a message if there is space for it now.
+ * 
+ * @return Token wouldBlock if the message does not fit yet, in which case done is not called.
+ */
+UART::Tx::Token UART::Tx::submit(const uint8_t * first, const uint8_t * last, Notify done, void * ctx){
+	const auto n = last - first;
+	if( (n <= 0) || (n >= buffSize) ) return wouldBlock;
+
+	auto p = tryAlloc(n);
+	if(p == nullptr) return wouldBlock;
+	std::copy(first, last, p);
+	return submit(n, done, ctx);
+}
+
+/**
+ * @brief Schedules immutable data for transmission directly from where it is held, if it can be queued now.
+ * 
+ * @return Token wouldBlock if the lane has no room yet, in which case done is not called.
+ * 
+ * @note The data must remain unchanged until sent. Data larger than a single DMA transfer takes several descriptors.
+ */
+UART::Tx::Token UART::Tx::submitInPlace(const uint8_t * first, const uint8_t * last, Notify done, void * ctx, Lane lane){
+	auto & q = queue(lane);
+	const auto n = last - first;
+	if(n <= 0) return wouldBlock;
+	if( ((n - 1) / maxTransfer + 1 > q.free()) || ((done != nullptr) && q.notifyFull()) ) return wouldBlock;
+
+	const Token t = token(lane, q.scCount + n);
+	if(done != nullptr) track(lane, t, done, ctx);
+	while(first != last){
+		const uint16_t k = (last - first > maxTransfer) ? maxTransfer : last - first;
+		enqueue(lane, first, k, false);
+		first += k;
+	}
+
+	nextTransmission();
+	return t;
+}
+
+/**
+ * @brief As submitInPlace(), waiting for transmissions to free the queue if necessary.
+ * 
+ * @return false if the data could not be queued within the timeout.
+ */
+bool UART::Tx::transmitInPlace(const uint8_t * first, const uint8_t * last, Lane lane){
+	if(last <= first) return false;
+
+	const auto tik = HAL_GetTick();
+	do{
+		if(submitInPlace(first, last, nullptr, nullptr, lane) != wouldBlock) return true;
+
+		if(!txBusy()) nextTransmission();
+		HAL_Delay(delayTime);
+	} while(HAL_GetTick() - tik < timeout);
+	return false;
+}
+
+/**
+ * @brief Checks whether every character of the message has been transmitted.
+ */
+bool UART::Tx::sent(Token t) const{
+	const auto & q = queues[t >> 31];
+	return static_cast<int32_t>((q.txCount - t) << 1) >= 0;	// Counts compared modulo 2^31.
+}
+
+/**
+ * @brief Publishes a descriptor to the transmitting context. Space must have been checked.
+ */
+void UART::Tx::enqueue(Lane l, const uint8_t * data, uint16_t n, bool ring){
+	auto & q = queue(l);
+	q.desc[q.head & (queueCapacity - 1u)] = {data, n, ring, HAL_GetTick()};
+	q.head = q.head + 1u;
+	q.scCount += n;
 }
 
+/**
+ * @brief Queues the notification for a message. Must precede the message's descriptors, so that it cannot complete
+ * 		  unnoticed. Space must have been checked.
+ */
+void UART::Tx::track(Lane l, Token t, Notify done, void * ctx){
+	auto & q = queue(l);
+	q.notifications[q.ntHead & (notifyCapacity - 1u)] = {t, done, ctx};
+	q.ntHead = q.ntHead + 1u;
+}
+
+/**
+ * @brief Completes the last transmission and begins the next from the COMMAND lane if it has anything queued, else
+ * 		  from the BULK lane.
+ */
 void UART::Tx::nextTransmission(){
-	if(!txBusy()){		// Only act if not currently transmitting.
-		tail = txHead;
+	if(txBusy()) return;	// Only act if not currently transmitting.
+
+	complete(queue(txLane), txLen);		// The last transmission has completed.
+	txLen = 0u;
+
+	if(queue(Lane::COMMAND).scheduled()) begin(Lane::COMMAND);
+	else if(queue(Lane::BULK).scheduled()) begin(Lane::BULK);
+}
+
+/**
+ * @brief Accounts for n characters transmitted from the front of the lane, releasing any buffer data they used.
+ */
+void UART::Tx::complete(Queue & q, uint16_t n){
+	q.txCount = q.txCount + n;
+	while(n > 0u){
+		const auto & d = q.desc[q.tail & (queueCapacity - 1u)];
+		const uint16_t remaining = d.size - q.offset;
+		if(n < remaining){
+			q.offset += n;
+			break;
+		}
+
+		n -= remaining;
+		q.offset = 0u;
+		if(d.ring) tail = const_cast<uint8_t *>(d.data) + d.size;
+		q.tail = q.tail + 1u;
+	}
+}
 
-		if(txHead >= lpHead){	// Last transmission was final transmission in current buffer loop. Loop variables.
-			tail = buff.begin();
-			txHead = buff.begin();
-			lpHead = alHead;
+/**
+ * @brief Transmits from the front of the lane, chaining every descriptor which continues on in memory into a single
+ * 		  transfer, up to the lane's transfer limit.
+ */
+void UART::Tx::begin(Lane l){
+	auto & q = queue(l);
+	const uint32_t limit = (l == Lane::BULK) ? bulkSlice : maxTransfer;
+	const uint32_t now = HAL_GetTick();
+
+	const uint8_t * start = q.desc[q.tail & (queueCapacity - 1u)].data + q.offset;
+	uint32_t len = 0u;
+	for(uint8_t i = q.tail; (i != q.head) && (len < limit); i++){
+		const auto & d = q.desc[i & (queueCapacity - 1u)];
+		const uint8_t * from = d.data + ((i == q.tail) ? q.offset : 0u);
+		if(from != start + len) break;
+
+		if(from == d.data){		// Transmission of the descriptor begins.
+			const uint32_t delay = now - d.queued;
+			q.stats.messages++;
+			q.stats.totalDelay += delay;
+			if(delay > q.stats.maxDelay) q.stats.maxDelay = delay;
 		}
 
-		if(!txScheduled()) return;	// No further transmission scheduled.
-		else{
-			txHead = (scHead > txHead) ? scHead : lpHead;	// Transmit either scheduled characters in front of the tail or the remaining loop.
-			HAL_UART_Transmit_DMA(hUart, const_cast<uint8_t *>(tail), txHead - tail);	// Begin transmission
-			return;
+		const uint32_t remaining = d.data + d.size - from;
+		const uint32_t take = (remaining < limit - len) ? remaining : limit - len;
+		len += take;
+		if(take < remaining) break;
+	}
+
+	txLane = l;
+	txLen = len;
+	HAL_UART_Transmit_DMA(hUart, const_cast<uint8_t *>(start), txLen);
+}
+
+/**
+ * @brief Delivers, in order within each lane, the notification of every message whose last character has been
+ * 		  transmitted.
+ * 
+ * @note Only called from the Tx complete and error interrupts, which are the sole consumers of the queues.
+ */
+void UART::Tx::notify(){
+	for(auto & q : queues){
+		while(q.ntTail != q.ntHead){
+			const Notification n = q.notifications[q.ntTail & (notifyCapacity - 1u)];
+			if(!sent(n.token)) break;
+			q.ntTail = q.ntTail + 1u;	// Released first, so that the slot is free to the callback's caller.
+			n.done(n.token, n.ctx);
 		}
 	}
 }
@@ -117,17 +309,40 @@ bool UART::Tx::txBusy() const {
 }
 
 bool UART::Tx::txScheduled() const{
-	return !(txHead == scHead);
+	for(const auto & q : queues) if(q.scheduled()) return true;
+	return false;
 }
 
 
+#if UART_RX_ZERO_COPY
 bool UART::Rx::dataReady(){
-	static uint16_t lastTail = 0;
-	bool retval = ((offloadBuff.tail > 0) && (lastTail != offloadBuff.tail)) ? true : false;
-	lastTail = offloadBuff.tail;
+	const uint16_t head = dmaRing.writeIndex();
+	bool retval = (dmaRing.available() > 0) && (lastHead != head);
+	lastHead = head;
 	return retval;
 }
 
+SegmentedView UART::Rx::peek() const { return dmaRing.view(); }
+void UART::Rx::consume(uint16_t n){ dmaRing.consume(n); }
+uint16_t UART::Rx::capacity() const { return dmaRing.capacity; }
+bool UART::Rx::resync(){ return dmaRing.resync(); }
+uint16_t UART::Rx::overruns() const { return dmaRing.overruns(); }
+
+#else
+bool UART::Rx::dataReady(){
+	const uint16_t head = offloadBuff.writeIndex();
+	bool retval = (offloadBuff.available() > 0) && (lastHead != head);
+	lastHead = head;
+	return retval;
+}
+
+SegmentedView UART::Rx::peek() const { return offloadBuff.view(); }
+void UART::Rx::consume(uint16_t n){ offloadBuff.consume(n); }
+uint16_t UART::Rx::capacity() const { return offloadBuff.capacity; }
+bool UART::Rx::resync(){ return offloadBuff.resync(); }	// Never true. The ring is only written by copying.
+uint16_t UART::Rx::overruns() const { return offloadBuff.overruns(); }
+
+#endif
 
 /**
  * @brief Initialises DMA UART Reception.
@@ -136,8 +351,34 @@ bool UART::Rx::dataReady(){
  * @note The DMA peripheral must be configured in circular mode.
  */
 void UART::Rx::beginReceive(){
-	HAL_UARTEx_ReceiveToIdle_DMA(hUart, dmaBuff.buff, dmaBuff.size);
 	receiving = true;
+	if(hUart->RxState != HAL_UART_STATE_READY) return;	// Already receiving. Restarting would replay the buffer.
+
+#if UART_RX_ZERO_COPY
+	// The DMA restarts at the beginning of storage. Any data between the consumer and the end of storage is stale
+	// after a restart, and will be rejected by the framing checks when it is scanned.
+	dmaHead = 0;
+	dmaRing.commit(0);
+	HAL_UARTEx_ReceiveToIdle_DMA(hUart, dmaRing.storage(), dmaRing.size);
+#else
+	dmaBuff.tail = 0;	// The DMA restarts at the beginning of the buffer.
+	HAL_UARTEx_ReceiveToIdle_DMA(hUart, dmaBuff.buff, dmaBuff.size);
+#endif
+}
+
+/**
+ * @brief Resumes reception after the UART was re-initialised. In zero-copy mode, unread data is discarded.
+ * 
+ * @note Only from the consumer's context, while the Rx DMA is stopped.
+ */
+void UART::Rx::restart(){
+#if UART_RX_ZERO_COPY
+	// The DMA restarts at the beginning of storage. Committing that position would publish the stale data after the
+	// old head as received, so the ring restarts with it instead.
+	dmaRing.reset();
+	dmaHead = 0;
+#endif
+	beginReceive();
 }
 
 void UART::Rx::endReceive(){
@@ -145,10 +386,16 @@ void UART::Rx::endReceive(){
 	receiving = false;
 }
 
-void UART::setBaudrate(uint32_t baud) const{
+/**
+ * @brief Re-initialises the UART peripheral at baud, resuming reception if it was on.
+ * 
+ * @note De-initialisation aborts any transmission in progress, so the caller should first wait until Tx is drained.
+ */
+void UART::setBaudrate(uint32_t baud){
 	if(HAL_UART_DeInit(hUart) == HAL_OK){
 		hUart->Init.BaudRate = baud;
 		HAL_UART_Init(hUart);
+		if(rx.receiving) rx.restart();	// De-initialisation stopped the Rx DMA.
 	}
 }
 
@@ -163,35 +410,48 @@ void UART::Tx::txCmpltCallback(){
 	// interruptsOff();
 	nextTransmission();
 	// interruptsOn();
+	notify();	// After the next transmission has begun, so that the line is not left idle.
 }
 
 
+#if UART_RX_ZERO_COPY
 /**
- * @brief 
+ * @brief Publishes newly received DMA data to the consumer.
  * 
  * @param size The new head position reported from the UART peripheral.
+ * 
+ * @note The data is already in place in dmaRing. Only the DMA position is stored, so the ISR cost is constant. The
+ * 		 half and complete events bound each advance to half the ring, so a lap of the consumer is always detected.
+ */
+void UART::Rx::rxEventCallback(uint16_t size){
+	if(size == dmaHead) return;	// Do nothing. Unknown event of zero size.
+	dmaHead = size;
+	dmaRing.commit(size);		// Position at the end of the storage wraps to the beginning.
+}
+
+#else
+/**
+ * @brief Moves newly received DMA data into the offload ring.
+ * 
+ * @param size The new head position reported from the UART peripheral.
+ * 
+ * @note This is the single producer of offloadBuff. If the ring is full the excess characters are discarded and
+ * 		 counted by the ring; the consumer is never interrupted or disabled.
  */
 void UART::Rx::rxEventCallback(uint16_t size){
 	if(size == dmaBuff.tail) return;	// Do nothing. Unknown event of zero size.
 
-	if(offloadBuff.tail == offloadBuff.size) offloadBuff.tail = 0;	// Flush if buffer completely full.
-	
-	// Offload buffer overflow. Reduce size to fill only available capacity. All further characters will be discarded.
-	uint16_t head = (offloadBuff.tail + (size - dmaBuff.tail) > offloadBuff.size) ?  // Will the offload buffer overflow if [size] characters are added.
-		(offloadBuff.size - offloadBuff.tail) + dmaBuff.tail : 	// Only move head to as many characters forward as will fit in offload buffer.
-		size; 	// Move head to new head
-	
 	/**
 	 * If an interrupt is missed, or suspended during debug, a condition may arise where the tail was not reset and is now greater than the head.
 	 * If so, the tail must be reset. The data at the end of the buffer should not be retrieved as this may create a race condition with the DMA controller.
 	 */
-	if( (dmaBuff.tail > size) || (dmaBuff.tail > head) ) dmaBuff.tail = 0;
+	if(dmaBuff.tail > size) dmaBuff.tail = 0;
 	
-	std::memcpy(offloadBuff.buff + offloadBuff.tail, dmaBuff.buff + dmaBuff.tail, head - dmaBuff.tail);
-	offloadBuff.tail += (head - dmaBuff.tail);
+	offloadBuff.write(dmaBuff.buff + dmaBuff.tail, size - dmaBuff.tail);
 	
-	dmaBuff.tail = (head == dmaBuff.size) ? 0 : head;	// Loop if at end else move tail to head.
+	dmaBuff.tail = (size == dmaBuff.size) ? 0 : size;	// Loop if at end else move tail to head.
 }
+#endif
 
 void UART::errorCallback(UART_HandleTypeDef * huart){
 	HAL_UART_DeInit(huart);
@@ -199,7 +459,8 @@ void UART::errorCallback(UART_HandleTypeDef * huart){
 	if(rx.receiving){
 		rx.beginReceive();	// Restart if receiving was on.
 	}
-	if(tx.txScheduled()) tx.nextTransmission();	// Restart scheduled transmission
+	tx.nextTransmission();	// Restart scheduled transmission. The interrupted one is treated as complete.
+	tx.notify();
 }
 
 /*** END OF FILE ***/
\ No newline at end of file
@@ -69,6 +69,29 @@ using vect = std::vector<uint8_t>;
 UBX::UBX(U1 msgClass, U1 msgID, U2 len) :
 	msgClass(msgClass), msgID(msgID), len(len) {}
 
+/**
+ * @brief Views the payload of a received frame.
+ * 
+ * @param len	The minimum payload length of the message. Longer payloads (later protocol versions) are accepted.
+ * @param first	The first character of the frame (sync1).
+ * @param last	One past the last character of the frame (ckB).
+ * 
+ * @note The checksum is not verified, which is the responsibility of the framer. If the frame is not of the expected
+ * 		 class, ID and length, the view is left invalid.
+ */
+UBX::UBX(U1 msgClass, U1 msgID, U2 len, const uint8_t * first, const uint8_t * last) :
+	msgClass(msgClass), msgID(msgID), len(len) {
+	const auto n = last - first;
+	if( (n < 8) || (first[0] != sync1) || (first[1] != sync2) || (first[2] != msgClass) || (first[3] != msgID) ) return;
+
+	const U2 frameLen = Field<U2, 4>::get(first);	// Length of the frame received.
+	if( (frameLen + 8 != n) || (frameLen < len) ) return;
+
+	this->len = frameLen;
+	cs = Checksum(first[n - 2], first[n - 1]);
+	payload = first + 6;
+}
+
 /**
  * @brief CalcuUBX::Checksum::Checksum object from a UBX frame prototype (without any checksum> attached.
  * 
@@ -89,9 +112,9 @@ UBX::Checksum::Checksum(U1 ckA, U1 ckB) :
 
 UBX::U2 UBX::getPayloadLen(const std::vector<uint8_t> & ubx){
 	if(ubx.size() >= 6){
-		#ifdef __ARMEL__	// If ARM Little Endian. This should be the default for all STM32 devices.
+		#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__	// This should be the default for all STM32 devices.
 		return *(uint16_t *)(ubx.data() + 4);
-		#elif __ARMEB__		// If ARM Big Endian.
+		#elif __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
 		return (*(uint16_t *)(
 		ubx.data() + 4) << 8) | *(
 		ubx.data() + 5);
@@ -102,6 +125,18 @@ UBX::U2 UBX::getPayloadLen(const std::vector<uint8_t> & ubx){
 	else return 0;
 }
 
+/**
+ * @brief Views the characters of a fixed-width text field, which are NUL-padded unless they fill the field.
+ * 
+ * @param offset	Of the field within the payload.
+ * @param width		Of the field. No character beyond it is read.
+ */
+StaticString UBX::text(U2 offset, U2 width) const{
+	if(!valid()) return StaticString();
+	const char * s = reinterpret_cast<const char *>(payload + offset);
+	return StaticString(s, strnlen(s, width));
+}
+
 std::array<uint8_t, 6> UBX::header() const{
 	std::array<uint8_t, 6> header;
 	header[0] = sync1;
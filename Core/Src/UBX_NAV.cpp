@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * @file			: UBX_NAV.cpp
+  * @brief			: Source for UBX_NAV.hpp
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  * 
+  * This file and its content are the copyright property of the author. All 
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the 
+  * accompanying file "LICENCE" for license details.
+  * 
+  ******************************************************************************
+  */
+
+#include "UBX_NAV.hpp"
+#include "CivilTime.hpp"
+
+/**
+ * @brief Rounds a signed fraction of a second [ns] to the nearest ms.
+ */
+static inline int32_t nanoMs(int32_t nano){ return (nano + ( (nano < 0) ? -500000 : 500000 )) / 1000000; }
+
+time_t UBX::NAV::PVT::epoch() const{
+	return static_cast<time_t>( CivilTime::epoch(get(year), get(month), get(day), get(hour), get(min), get(sec)) );
+}
+
+int64_t UBX::NAV::PVT::epochMs() const{
+	return CivilTime::epoch(get(year), get(month), get(day), get(hour), get(min), get(sec)) * 1000 + nanoMs(get(nano));
+}
+
+time_t UBX::NAV::TIME::UTC::epoch() const{
+	return static_cast<time_t>( CivilTime::epoch(get(year), get(month), get(day), get(hour), get(min), get(sec)) );
+}
+
+int64_t UBX::NAV::TIME::UTC::epochMs() const{
+	return CivilTime::epoch(get(year), get(month), get(day), get(hour), get(min), get(sec)) * 1000 + nanoMs(get(nano));
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,160 @@
+/**
+  ******************************************************************************
+  * @file			: decode_bench.cpp
+  * @brief			: Per-Sentence Cost of the NMEA Field Decoders Against libc
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage: decode_bench
+ *
+ * Times the decoding of one GNS, GLL, GSA and ZDA sentence, and the verification of one checksum, in two ways:
+ * 	libc	The sscanf, strtof and strtoul calls used before NMEA_Standard::Field, on the fields' c_str().
+ * 	Field	The sentence constructors, as the driver decodes them.
+ * Both decode from the same split Sentence, so the split is not timed. Each libc decoder writes the same members as
+ * its constructor, in the types of the time (float where the driver now keeps scaled integers).
+ */
+
+#include "Capture.hpp"
+#include "M9N_C_API.hpp"
+#include "NMEA_Standard.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+typedef NMEA_Standard::Sentence Sentence;
+
+static volatile uint32_t sink;	// Keeps each result live.
+
+/* libc Decoders, as Before NMEA_Standard::Field */
+
+struct LibcTime{ uint16_t hh, mm; float ss; };
+struct LibcCoordinate{ int16_t deg; float min; };
+
+static LibcTime libcTime(const StaticString & s){
+	LibcTime t = {};
+	std::sscanf(s.c_str(), "%2hu%2hu%5f", &t.hh, &t.mm, &t.ss);
+	return t;
+}
+
+static LibcCoordinate libcCoordinate(const StaticString & s){
+	LibcCoordinate c = {};
+	auto const decI = s.find('.');
+	if( (decI != StaticString::npos) && (s.length() >= 6) && (decI > 3) ){
+		char fmt[8];
+		std::snprintf(fmt, 8, "%%%1dhd%%8f", static_cast<int>(decI-2));
+		std::sscanf(s.c_str(), fmt, &c.deg, &c.min);
+	}
+	return c;
+}
+
+static uint32_t libcGNS(const Sentence & f){
+	const LibcTime t = libcTime(f[1]);
+	const LibcCoordinate lat = libcCoordinate(f[2]), lon = libcCoordinate(f[4]);
+	uint8_t numSV = 0u;
+	float hdop = 0.0f, alt = 0.0f, sep = 0.0f, diffAge = 0.0f;
+	uint16_t diffStation = 0u;
+	if(!f[7].empty())	numSV		= std::strtoul(f[7].c_str(), nullptr, 10);
+	if(!f[8].empty())	hdop		= std::strtof(f[8].c_str(), nullptr);
+	if(!f[9].empty())	alt			= std::strtof(f[9].c_str(), nullptr);
+	if(!f[10].empty())	sep			= std::strtof(f[10].c_str(), nullptr);
+	if(!f[11].empty())	diffAge		= std::strtof(f[11].c_str(), nullptr);
+	if(!f[12].empty())	diffStation	= std::strtoul(f[12].c_str(), nullptr, 10);
+	return t.hh + lat.deg + lon.deg + numSV + diffStation + static_cast<uint32_t>(t.ss + lat.min + lon.min + hdop + alt + sep + diffAge);
+}
+
+static uint32_t libcGLL(const Sentence & f){
+	const LibcCoordinate lat = libcCoordinate(f[1]), lon = libcCoordinate(f[3]);
+	const LibcTime t = libcTime(f[5]);
+	return t.hh + lat.deg + lon.deg + static_cast<uint32_t>(t.ss + lat.min + lon.min);
+}
+
+static uint32_t libcGSA(const Sentence & f){
+	uint8_t navMode = 0u, systemId = 0u, svid[12];
+	float pdop = 0.0f, hdop = 0.0f, vdop = 0.0f;
+	if(!f[2].empty())	navMode		= std::strtoul(f[2].c_str(), nullptr, 10);
+	for(int i = 0; i < 12; i++)
+						svid[i]		= (!f[3+i].empty()) ? std::strtoul(f[3+i].c_str(), nullptr, 10) : 0u;
+	if(!f[15].empty())	pdop		= std::strtof(f[15].c_str(), nullptr);
+	if(!f[16].empty())	hdop		= std::strtof(f[16].c_str(), nullptr);
+	if(!f[17].empty())	vdop		= std::strtof(f[17].c_str(), nullptr);
+	if(!f[18].empty())	systemId	= std::strtoul(f[18].c_str(), nullptr, 16);
+	return navMode + systemId + svid[0] + svid[11] + static_cast<uint32_t>(pdop + hdop + vdop);
+}
+
+static uint32_t libcZDA(const Sentence & f){
+	const LibcTime t = libcTime(f[1]);
+	return t.hh + static_cast<uint32_t>(t.ss) + std::strtoul(f[2].c_str(), nullptr, 10) + std::strtoul(f[3].c_str(), nullptr, 10)
+		+ std::strtoul(f[4].c_str(), nullptr, 10) + std::strtoul(f[5].c_str(), nullptr, 10) + std::strtoul(f[6].c_str(), nullptr, 10);
+}
+
+static bool libcValid(const StaticString & nmea){
+	auto astI = nmea.rfind('*');
+	if(nmea.empty() || astI == StaticString::npos) return false;
+	uint16_t givenC = 0;
+	auto nConv = std::sscanf(nmea.substr(astI, 5).c_str(), "*%2hX\r\n", &givenC);
+	if(nConv != 1) return false;
+	uint8_t chk = 0x00u;
+	for(auto & c : nmea){
+		if(c == '$') continue;
+		else if (c == '*') break;
+		else chk ^= c;
+	}
+	return givenC == chk;
+}
+
+/* Timing */
+
+/**
+ * @return Host time per call of f [ns].
+ */
+template<typename F>
+static double time(F f){
+	const unsigned n = 200000u;
+	const auto t0 = std::chrono::steady_clock::now();
+	for(unsigned i = 0u; i < n; i++) sink = sink + f();
+	const auto t1 = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+}
+
+template<typename L, typename F>
+static void compare(const char * name, L libc, F field){
+	const double l = time(libc), d = time(field);
+	printf("%-8s %8.1f %8.1f %7.1fx\n", name, l, d, l / d);
+}
+
+int main(){
+	const std::string gns = Capture::sentence("GNGNS,092300.00,4717.11399,N,00833.91590,E,AANN,08,1.01,499.6,48.0,,,V");
+	const std::string gll = Capture::sentence("GNGLL,4717.11364,N,00833.91565,E,092300.00,A,A");
+	const std::string gsa = Capture::sentence("GNGSA,A,3,23,29,07,08,09,18,26,,,,,,1.94,1.18,1.54,1");
+	const std::string zda = Capture::sentence("GNZDA,092300.00,09,12,2022,00,00");
+	const StaticString gnsS(gns.c_str()), gllS(gll.c_str()), gsaS(gsa.c_str()), zdaS(zda.c_str());
+	const Sentence gnsF(gnsS), gllF(gllS), gsaF(gsaS), zdaF(zdaS);
+	if(!gnsF.valid() || !gllF.valid() || !gsaF.valid() || !zdaF.valid() || !libcValid(gsaS)) return 1;
+
+	printf("[ns]         libc    Field speedup\n");
+	compare("GNS", [&]{ return libcGNS(gnsF); }, [&]{ return NMEA_Standard::GNS(gnsF).toString(nullptr).size(); });
+	compare("GLL", [&]{ return libcGLL(gllF); }, [&]{ return NMEA_Standard::GLL(gllF).lat.deg7; });
+	compare("GSA", [&]{ return libcGSA(gsaF); }, [&]{ return NMEA_Standard::GSA(gsaF).pdop; });
+	compare("ZDA", [&]{ return libcZDA(zdaF); }, [&]{ return NMEA_Standard::ZDA(zdaF).time.year; });
+	compare("Checksum", [&]{ return libcValid(gsaS); }, [&]{ return NMEA_Standard::valid(gsaS); });
+	return 0;
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,146 @@
+/**
+  ******************************************************************************
+  * @file			: framer_bench.cpp
+  * @brief			: Throughput of the Framer Against the Former Multi-Pass Scan
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage: framer_bench [capture]
+ *
+ * Replays a capture (or the generated NMEA stream) into an Rx ring in bursts of one DMA buffer, framing the ring after
+ * each burst as M9N::scanMessages does, and reports the throughput of:
+ * 	legacy	The scan replaced by Framer: count_if passes, index VLAs and "$"/"\r\n" pairing over a copy of the ring.
+ * 			Its UBX branch never produced a frame and is omitted. It does not verify checksums.
+ * 	framer	Framer::next() over a view of the ring, verifying checksums.
+ */
+
+#include "Capture.hpp"
+#include "Framer.hpp"
+#include "M9N_C_API.hpp"
+#include "RingBuffer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+static const size_t ringSize = 8u * 254u;	// As UART::Rx.
+static const uint16_t burst = 254u;			// One DMA buffer.
+typedef RingBuffer<ringSize> Ring;
+
+/**
+ * @brief M9N::scanMessages before the Framer (as of the lock-free ring), with interpretNmea() replaced by a count.
+ */
+static uint32_t legacyScan(Ring & ring){
+	std::pair<uint8_t *, uint16_t> s;	// {array, size}
+	s.second = ring.available();
+	if(s.second == 0) return 0u;
+	uint8_t buffCopy[s.second];
+	s.first = buffCopy;
+	ring.peek(s.first, s.second);
+
+	uint16_t lenD = std::count_if(s.first, s.first + s.second, [](uint8_t c) -> bool{ return c == '$'; });
+	uint16_t lenL = std::count_if(s.first, s.first + s.second, [](uint8_t c) -> bool{ return c == '\r'; });
+	uint16_t lenU = std::count_if(s.first, s.first + s.second, [](uint8_t c) -> bool{ return c == 0xB5; });
+	uint16_t dollars[(lenD > 0) ? lenD : 1u];
+	uint16_t lfcrs	[(lenL > 0) ? lenL : 1u];
+	uint16_t mus	[(lenU > 0) ? lenU : 1u];
+	std::pair<uint16_t*, uint16_t> d = {dollars	, 0u};
+	std::pair<uint16_t*, uint16_t> l = {lfcrs	, 0u};
+	std::pair<uint16_t*, uint16_t> u = {mus		, 0u};
+
+	for(uint16_t i = 0; i < s.second - 1; i++){
+		switch(s.first[i]){
+			case '$':	d.first[d.second++] = i; break;
+			case '\r':	if(s.first[i+1] == '\n') l.first[l.second++] = i; break;
+			case 0xB5:	if(s.first[i+1] == 0x62) u.first[u.second++] = i; break;
+			default: continue;
+		}
+	}
+
+	size_t lenR = (d.second > l.second) ? d.second : l.second;
+	std::pair<uint16_t, uint16_t> nmeaRanges[(lenR > 0) ? lenR : 1u];
+	lenD = d.second;
+	lenL = l.second;
+	d.second = l.second = 0u;
+	uint16_t k = 0u;
+	while( (d.second < lenD) && (l.second < lenL) ){
+		if(d.first[d.second] > l.first[l.second]) l.second++;
+		else{
+			nmeaRanges[k++] = {d.first[d.second++], static_cast<uint16_t>(l.first[l.second++] + 2)};
+			while((d.second < lenD) && (d.first[d.second] < nmeaRanges[k-1].second) ) nmeaRanges[k-1].first = d.first[d.second++];
+		}
+	}
+
+	uint16_t lastC = (k > 0) ? nmeaRanges[k-1].second : 0;
+	if( (lastC == 0) && (s.second >= ring.capacity) ) lastC = s.second;
+	ring.consume(lastC);
+	return k;
+}
+
+static uint32_t framerScan(Ring & ring, Framer & framer){
+	const SegmentedView v = ring.view();
+	uint32_t k = 0u;
+	Framer::Frame f;
+	while(framer.next(v, f)) k++;
+	ring.consume(framer.release());
+	return k;
+}
+
+/**
+ * @brief Replays s through a ring passes times, scanning after each burst.
+ *
+ * @return Host time [s]. frames is set to the frames found in one pass.
+ */
+template<typename Scan>
+static double replay(const Capture::Stream & s, unsigned passes, uint32_t & frames, Scan scan){
+	static Ring ring;
+	ring.consume(ring.available());
+	frames = 0u;
+	const auto t0 = std::chrono::steady_clock::now();
+	for(unsigned p = 0u; p < passes; p++){
+		for(size_t i = 0u; i < s.size(); i += burst){
+			const uint16_t n = static_cast<uint16_t>(std::min<size_t>(burst, s.size() - i));
+			ring.write(s.data() + i, n);
+			const uint32_t k = scan(ring);
+			if(p == 0u) frames += k;
+		}
+	}
+	const auto t1 = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main(int argc, char ** argv){
+	const Capture::Stream s = (argc > 1) ? Capture::load(argv[1]) : Capture::nmea(1000u);
+	if(s.empty()) return 1;
+	const unsigned passes = static_cast<unsigned>(std::max<size_t>(1u, (64u << 20) / s.size()));	// About 64 MB.
+	const double mb = static_cast<double>(s.size()) * passes / 1e6;
+
+	uint32_t legacyFrames, framerFrames;
+	const double legacy = replay(s, passes, legacyFrames, [](Ring & r){ return legacyScan(r); });
+	Framer framer;
+	const double framed = replay(s, passes, framerFrames, [&](Ring & r){ return framerScan(r, framer); });
+
+	printf("Capture: %zu bytes x %u passes\n", s.size(), passes);
+	printf("legacy:  %7.1f MB/s, %u frames per pass (unverified)\n", mb / legacy, legacyFrames);
+	printf("framer:  %7.1f MB/s, %u frames per pass, %u errors\n", mb / framed, framerFrames,
+		static_cast<unsigned>(framer.statistics().errors / passes));
+	printf("speedup: %.2fx\n", legacy / framed);
+	return 0;
+}
+
+/*** END OF FILE ***/
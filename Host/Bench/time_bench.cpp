@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file			: time_bench.cpp
+  * @brief			: Per-Call Cost of CivilTime Against mktime() and timegm()
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage: time_bench
+ *
+ * Checks that CivilTime::epoch() agrees with timegm() at a spread of times from 1970 to 2105, and that every day from
+ * 0000-03-01 round trips through civilFromDays(), then times the conversion of a UTC date and time in three ways:
+ * 	mktime		As used before CivilTime, with TZ=UTC so that it agrees. Consults the time zone on every call.
+ * 	timegm		The GNU extension, without a time zone.
+ * 	CivilTime	CivilTime::epoch(), as the driver converts.
+ * Returns non-zero if any conversion disagrees.
+ */
+
+#include "CivilTime.hpp"
+#include "M9N_C_API.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+static volatile int64_t sink;	// Keeps each result live.
+
+static struct tm civil(int year, int month, int day, int hh, int mm, int ss){
+	struct tm t = {};
+	t.tm_year = year - 1900;
+	t.tm_mon = month - 1;
+	t.tm_mday = day;
+	t.tm_hour = hh;
+	t.tm_min = mm;
+	t.tm_sec = ss;
+	return t;
+}
+
+/**
+ * @return The number of conversions which disagree.
+ */
+static unsigned agreement(){
+	unsigned bad = 0u;
+	for(int32_t z = CivilTime::daysFromCivil(0, 3, 1); z <= CivilTime::daysFromCivil(2200, 1, 1); z++){
+		const CivilTime::Date d = CivilTime::civilFromDays(z);
+		if(CivilTime::daysFromCivil(d.year, d.month, d.day) != z) bad++;
+	}
+	for(int y = 1970; y < 2106; y++) for(int m = 1; m <= 12; m++) for(int d = 1; d <= 28; d += 3){
+		const int hh = (y * 7 + m) % 24, mm = (d * 13) % 60, ss = (y + m + d) % 60;
+		struct tm t = civil(y, m, d, hh, mm, ss);
+		if(timegm(&t) != CivilTime::epoch(y, m, d, hh, mm, ss)) bad++;
+	}
+	return bad;
+}
+
+/* Timing */
+
+/**
+ * @return Host time per call of f [ns].
+ */
+template<typename F>
+static double time(F f){
+	const unsigned n = 2000000u;
+	const auto t0 = std::chrono::steady_clock::now();
+	for(unsigned i = 0u; i < n; i++) sink = sink + f(i);
+	const auto t1 = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+}
+
+int main(){
+	setenv("TZ", "UTC", 1);
+	tzset();
+
+	const unsigned bad = agreement();
+	printf("Conversions disagreeing: %u\n", bad);
+	if(bad) return 1;
+
+	// December 2022, as the receiver would give it. The day varies so that nothing is hoisted.
+	const double m = time([](unsigned i){ struct tm t = civil(2022, 12, 1 + i % 28u, i % 24u, i % 60u, i % 60u); return mktime(&t); });
+	const double g = time([](unsigned i){ struct tm t = civil(2022, 12, 1 + i % 28u, i % 24u, i % 60u, i % 60u); return timegm(&t); });
+	const double c = time([](unsigned i){ return CivilTime::epoch(2022, 12, 1 + i % 28u, i % 24u, i % 60u, i % 60u); });
+
+	printf("[ns]      mktime   timegm CivilTime\n");
+	printf("epoch   %8.1f %8.1f  %8.1f\n", m, g, c);
+	return 0;
+}
+
+/*** END OF FILE ***/
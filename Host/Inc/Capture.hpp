@@ -0,0 +1,89 @@
+/**
+  ******************************************************************************
+  * @file			: Capture.hpp
+  * @brief			: Receiver Byte Streams for Host Tests and Benchmarks
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage:
+ * load() reads a recorded capture. Where none is given, nmea() generates the output of a stationary receiver in its
+ * default NMEA configuration, one epoch per second from 2022-12-09 09:23:00 UTC, so that every test and benchmark
+ * runs on the same known stream.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+#include <vector>
+
+class Capture{
+public:
+	typedef std::vector<uint8_t> Stream;
+
+	/**
+	 * @brief The contents of a file, or of stdin if path is nullptr.
+	 */
+	static Stream load(const char * path){
+		Stream data;
+		FILE * f = path ? fopen(path, "rb") : stdin;
+		if(f == nullptr){
+			perror(path);
+			return data;
+		}
+		uint8_t buff[4096];
+		size_t n;
+		while( (n = fread(buff, 1, sizeof(buff), f)) > 0 ) data.insert(data.end(), buff, buff + n);
+		if(path) fclose(f);
+		return data;
+	}
+
+	/**
+	 * @brief A complete NMEA sentence, with "$", checksum and "\r\n" added to body.
+	 */
+	static std::string sentence(const std::string & body){
+		uint8_t cs = 0u;
+		for(char c : body) cs ^= static_cast<uint8_t>(c);
+		char tail[8];
+		snprintf(tail, sizeof(tail), "*%02X\r\n", cs);
+		return "$" + body + tail;
+	}
+
+	/**
+	 * @brief RMC, VTG, GGA, GSA, 3 GSV, GLL and ZDA sentences for each epoch. 511 characters per epoch.
+	 */
+	static Stream nmea(unsigned epochs){
+		std::string s;
+		for(unsigned e = 0u; e < epochs; e++){
+			char t[16];
+			snprintf(t, sizeof(t), "09%02u%02u.00", (23u + e / 60u) % 60u, e % 60u);
+			const std::string ts(t);
+			s += sentence("GNRMC," + ts + ",A,4717.11399,N,00833.91590,E,0.004,77.52,091222,,,A,V");
+			s += sentence("GNVTG,77.52,T,,M,0.004,N,0.008,K,A");
+			s += sentence("GNGGA," + ts + ",4717.11399,N,00833.91590,E,1,08,1.01,499.6,M,48.0,M,,");
+			s += sentence("GNGSA,A,3,23,29,07,08,09,18,26,,,,,,1.94,1.18,1.54,1");
+			s += sentence("GPGSV,3,1,09,07,17,138,42,08,56,210,46,09,23,048,44,16,66,287,,1");
+			s += sentence("GPGSV,3,2,09,18,21,066,43,23,44,298,47,26,31,161,44,27,17,043,,1");
+			s += sentence("GPGSV,3,3,09,29,48,112,47,1");
+			s += sentence("GNGLL,4717.11364,N,00833.91565,E," + ts + ",A,A");
+			s += sentence("GNZDA," + ts + ",09,12,2022,00,00");
+		}
+		return Stream(s.begin(), s.end());
+	}
+};
+
+/*** END OF FILE ***/
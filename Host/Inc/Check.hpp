@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * @file			: Check.hpp
+  * @brief			: Pass/Fail Reporting for Host Tests
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage:
+ * Each test states every property with check(), which prints one "what: PASS" or "what: FAIL" line, and returns
+ * result() from main() so that `make check` stops at the first failing test.
+ */
+
+#pragma once
+
+#include <stdio.h>
+
+inline int failures = 0;	// Checks failed so far.
+
+inline void check(bool ok, const char * what){
+	if(!ok) failures++;
+	printf("%s: %s\n", what, ok ? "PASS" : "FAIL");
+}
+
+inline int result(){ return (failures == 0) ? 0 : 1; }
+
+/*** END OF FILE ***/
@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file			: HAL_Sim.hpp
+  * @brief			: Controls for the Simulated Host HAL
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Simulation Model:
+ * Time is simulated in 1 ms ticks and only advances through advance() or HAL_Delay(). On each tick, every UART moves
+ * characters at its configured Init.BaudRate (10 bits per character). Received characters are written into the
+ * buffer given to HAL_UARTEx_ReceiveToIdle_DMA in circular mode, raising HAL_UARTEx_RxEventCallback at the half,
+ * full and idle points as the ST HAL does. Transmissions started by HAL_UART_Transmit_DMA complete once their
+ * characters have been clocked out, are handed to the Tx sink and raise HAL_UART_TxCpltCallback.
+ *
+ * Callbacks run synchronously from within advance(), standing in for interrupt preemption. Callbacks for a UART are
+ * held pending while its IRQ is disabled through HAL_NVIC_DisableIRQ and raised when it is re-enabled.
+ *
+ * By default the far end of each line follows the UART's baudrate. setRemoteBaudrate() fixes the far end's baudrate
+ * instead. Characters then arrive at the remote baudrate, and while it differs from Init.BaudRate every character is
+ * garbled in both directions, as a mis-sampled character would be: received characters before they reach the DMA
+ * buffer, transmitted characters before they reach the Tx sink.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "stm32l4xx_hal.h"
+
+class HAL_Sim{
+public:
+	typedef void (*TxSink)(UART_HandleTypeDef * huart, const uint8_t * data, uint16_t size, void * ctx);
+
+	static void feed(UART_HandleTypeDef * huart, const uint8_t * data, size_t size);	// Queue characters to arrive on the Rx line.
+	static size_t pending(UART_HandleTypeDef * huart);									// Characters queued but not yet on the line.
+	static void setTxSink(UART_HandleTypeDef * huart, TxSink sink, void * ctx);			// Receives every completed transmission.
+	static void setRemoteBaudrate(UART_HandleTypeDef * huart, uint32_t baud);			// 0 follows the UART's baudrate.
+
+	static void advance(uint32_t ms);	// Advance the simulated clock.
+};
+
+/*** END OF FILE ***/
@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file			: stm32l4xx_hal.h
+  * @brief			: Minimal STM32L4 HAL Stand-In for Host Builds
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Only the subset of the STM32L4 HAL used by the driver is declared here, with the same names, signatures and state
+ * encodings as the ST HAL. The implementation in stm32l4xx_hal_sim.cpp simulates the UART/DMA peripherals against a
+ * simulated clock and drives the real HAL callbacks. See HAL_Sim.hpp for the simulation controls.
+ */
+
+#ifndef HOST_STM32L4XX_HAL_H
+#define HOST_STM32L4XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum{
+	HAL_OK		= 0x00U,
+	HAL_ERROR	= 0x01U,
+	HAL_BUSY	= 0x02U,
+	HAL_TIMEOUT	= 0x03U
+} HAL_StatusTypeDef;
+
+typedef enum{
+	DMA1_Channel1_IRQn	= 11,
+	DMA1_Channel2_IRQn	= 12,
+	USART1_IRQn			= 37,
+	USART2_IRQn			= 38,
+	USART3_IRQn			= 39,
+	UART4_IRQn			= 52,
+	UART5_IRQn			= 53,
+	HAL_SIM_IRQn_COUNT	= 64
+} IRQn_Type;
+
+typedef struct{
+	uint32_t id;	// Distinguishes simulated peripheral instances.
+} USART_TypeDef;
+
+extern USART_TypeDef HAL_Sim_USART1;
+extern USART_TypeDef HAL_Sim_UART4;
+#define USART1	(&HAL_Sim_USART1)
+#define UART4	(&HAL_Sim_UART4)
+
+typedef uint32_t HAL_UART_StateTypeDef;
+#define HAL_UART_STATE_RESET		0x00000000U
+#define HAL_UART_STATE_READY		0x00000020U
+#define HAL_UART_STATE_BUSY			0x00000024U
+#define HAL_UART_STATE_BUSY_TX		0x00000021U
+#define HAL_UART_STATE_BUSY_RX		0x00000022U
+#define HAL_UART_STATE_BUSY_TX_RX	0x00000023U
+#define HAL_UART_STATE_ERROR		0x000000E0U
+
+typedef struct{
+	uint32_t BaudRate;
+	uint32_t WordLength;
+	uint32_t StopBits;
+	uint32_t Parity;
+	uint32_t Mode;
+	uint32_t HwFlowCtl;
+	uint32_t OverSampling;
+} UART_InitTypeDef;
+
+typedef struct __UART_HandleTypeDef{
+	USART_TypeDef * Instance;
+	UART_InitTypeDef Init;
+	volatile HAL_UART_StateTypeDef gState;	// Global and Tx state.
+	volatile HAL_UART_StateTypeDef RxState;	// Rx state.
+} UART_HandleTypeDef;
+
+/* Core */
+uint32_t HAL_GetTick(void);
+void HAL_Delay(uint32_t Delay);
+
+/* Cortex */
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn);
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn);
+
+/* UART */
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart);
+HAL_UART_StateTypeDef HAL_UART_GetState(const UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+
+/* UART Callbacks. Defined by the application. */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart);
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart);
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_STM32L4XX_HAL_H */
+
+/*** END OF FILE ***/
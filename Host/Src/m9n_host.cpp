@@ -0,0 +1,113 @@
+/**
+  ******************************************************************************
+  * @file			: m9n_host.cpp
+  * @brief			: Host Driver for the M9N Protocol Stack on the Simulated HAL
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Usage: m9n_host [-b baudrate] [-r receiver_baudrate] [-a] [-p period_ms] [capture]
+ *
+ * Plays a captured receiver byte stream (a file, or stdin if omitted) into the simulated UART at the given baudrate,
+ * running the same GPS_Update() main loop as the target with the given period. Reports the resulting live data,
+ * framing statistics and the host processing time, for use with perf, valgrind and the sanitizers.
+ *
+ * -r plays the capture at a receiver baudrate other than the UART's, garbling it as a mismatched link would. -a then
+ * runs M9N::autobaud() over the capture before the main loop, and reports the baudrate found and the time taken.
+ */
+
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+static std::vector<uint8_t> readAll(FILE * f){
+	std::vector<uint8_t> data;
+	uint8_t buff[4096];
+	size_t n;
+	while( (n = fread(buff, 1, sizeof(buff), f)) > 0 ) data.insert(data.end(), buff, buff + n);
+	return data;
+}
+
+int main(int argc, char ** argv){
+	uint32_t baud = 38400u;
+	uint32_t remote = 0u;
+	bool discover = false;
+	uint32_t period = 100u;
+	const char * path = nullptr;
+
+	for(int i = 1; i < argc; i++){
+		if( (strcmp(argv[i], "-b") == 0) && (i + 1 < argc) ) baud = strtoul(argv[++i], nullptr, 10);
+		else if( (strcmp(argv[i], "-r") == 0) && (i + 1 < argc) ) remote = strtoul(argv[++i], nullptr, 10);
+		else if(strcmp(argv[i], "-a") == 0) discover = true;
+		else if( (strcmp(argv[i], "-p") == 0) && (i + 1 < argc) ) period = strtoul(argv[++i], nullptr, 10);
+		else path = argv[i];
+	}
+
+	FILE * f = path ? fopen(path, "rb") : stdin;
+	if(f == nullptr){
+		perror(path);
+		return 1;
+	}
+	const auto capture = readAll(f);
+	if(path) fclose(f);
+
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = baud;
+	HAL_UART_Init(&huart4);
+	HAL_Sim::setRemoteBaudrate(&huart4, remote);
+
+	GPS_Init();
+	HAL_Sim::feed(&huart4, capture.data(), capture.size());
+
+	M9N::Autobaud found{};
+	if(discover) found = m9n.autobaud();
+
+	const auto t0 = std::chrono::steady_clock::now();
+	while(HAL_Sim::pending(&huart4) > 0u){
+		HAL_Delay(period);
+		GPS_Update();
+	}
+	HAL_Delay(period);
+	GPS_Update();
+	const auto t1 = std::chrono::steady_clock::now();
+
+	const double secs = std::chrono::duration<double>(t1 - t0).count();
+	const auto & stats = m9n.statistics();
+
+	printf("Input:       %zu bytes in %u ms simulated, %.3f ms host (%.1f MB/s)\n",
+		capture.size(), HAL_GetTick(), secs * 1e3, capture.size() / secs / 1e6);
+	if(discover) printf("Autobaud:    %s %u Bd after %u frames in %u ms\n",
+		found.locked ? "locked" : "not found at", static_cast<unsigned>(found.baud), found.frames, found.elapsed);
+	printf("Frames:      %u NMEA, %u UBX, %u errors, %u characters overrun\n", stats.nmea, stats.ubx, stats.errors, m9n.overruns());
+	const Coord_t & c = gpsDataLive.coordinates;
+	const Diagnostic_t & d = gpsDataLive.diag;
+	printf("Coordinates: lat %.7f, lon %.7f, time %u, tic %u\n", c.lat * 1e-7, c.longi * 1e-7, c.time, c.tic);
+	printf("Motion:      alt %.3f m, speed %.3f m/s, course %.5f deg\n", c.alt * 1e-3, c.speed * 1e-3, c.course * 1e-5);
+	printf("Diagnostic:  PDOP %u.%02u, HDOP %u.%02u, VDOP %u.%02u, sats %d, fix %d, quality %d\n",
+		d.PDOP / 100u, d.PDOP % 100u,
+		d.HDOP / 100u, d.HDOP % 100u,
+		d.VDOP / 100u, d.VDOP % 100u,
+		d.num_sats, d.fix_type, d.fix_quality);
+	return 0;
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,271 @@
+/**
+  ******************************************************************************
+  * @file			: stm32l4xx_hal_sim.cpp
+  * @brief			: Simulated STM32L4 HAL for Host Builds
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+#include "HAL_Sim.hpp"
+
+#include <deque>
+#include <vector>
+
+USART_TypeDef HAL_Sim_USART1{1u};
+USART_TypeDef HAL_Sim_UART4{4u};
+
+namespace{
+
+struct Link{
+	UART_HandleTypeDef * huart = nullptr;
+
+	/* Rx Line and DMA */
+	std::deque<uint8_t> line;		// Characters still to arrive.
+	double rxCredit = 0.0;			// Fractional characters accumulated at the baudrate.
+	uint8_t * rxBuff = nullptr;		// Circular DMA buffer.
+	uint16_t rxSize = 0u;
+	uint16_t rxPos = 0u;
+	bool rxActive = false;
+	bool rxEventPending = false;
+	uint16_t rxEventSize = 0u;
+
+	/* Tx DMA */
+	const uint8_t * txData = nullptr;
+	uint16_t txSize = 0u;
+	double txCredit = 0.0;
+	bool txCpltPending = false;
+	HAL_Sim::TxSink sink = nullptr;
+	void * sinkCtx = nullptr;
+
+	/* Far End */
+	uint32_t remoteBaud = 0u;		// 0 follows the UART.
+	uint32_t noise = 0x2545F491u;	// Garbling state.
+};
+
+Link links[4];
+uint32_t tick = 0u;
+bool irqDisabled[HAL_SIM_IRQn_COUNT] = {};
+
+Link & link(const UART_HandleTypeDef * huart){
+	for(auto & l : links){
+		if(l.huart == huart) return l;
+		if(l.huart == nullptr){
+			l.huart = const_cast<UART_HandleTypeDef *>(huart);
+			return l;
+		}
+	}
+	static Link overflow;	// More simulated UARTs than supported. Degrades to a dead link.
+	return overflow;
+}
+
+IRQn_Type irqOf(const UART_HandleTypeDef * huart){
+	return (huart->Instance == UART4) ? UART4_IRQn : USART1_IRQn;
+}
+
+double charsPerTick(const UART_HandleTypeDef * huart){
+	return huart->Init.BaudRate / 10.0 / 1000.0;
+}
+
+bool mismatched(const Link & l){
+	return (l.remoteBaud != 0u) && (l.remoteBaud != l.huart->Init.BaudRate);
+}
+
+uint8_t garble(Link & l, uint8_t c){
+	l.noise ^= l.noise << 13;	// xorshift32
+	l.noise ^= l.noise >> 17;
+	l.noise ^= l.noise << 5;
+	return c ^ static_cast<uint8_t>(l.noise | 1u);	// Never unchanged.
+}
+
+void rxEvent(Link & l, uint16_t size){
+	if(irqDisabled[irqOf(l.huart)]){
+		l.rxEventPending = true;
+		l.rxEventSize = size;
+	}
+	else HAL_UARTEx_RxEventCallback(l.huart, size);
+}
+
+void txCplt(Link & l){
+	if(irqDisabled[irqOf(l.huart)]) l.txCpltPending = true;
+	else HAL_UART_TxCpltCallback(l.huart);
+}
+
+void serviceRx(Link & l){
+	if(l.line.empty()) return;
+
+	l.rxCredit += (l.remoteBaud != 0u) ? l.remoteBaud / 10.0 / 1000.0 : charsPerTick(l.huart);
+	bool moved = false;
+	while( (l.rxCredit >= 1.0) && !l.line.empty() ){
+		const uint8_t c = mismatched(l) ? garble(l, l.line.front()) : l.line.front();
+		l.line.pop_front();
+		l.rxCredit -= 1.0;
+
+		if(!l.rxActive) continue;	// Nobody listening. Character lost.
+		moved = true;
+		l.rxBuff[l.rxPos++] = c;
+		if(l.rxPos == l.rxSize / 2u) rxEvent(l, l.rxPos);	// Half Transfer
+		else if(l.rxPos == l.rxSize){						// Transfer Complete. Circular DMA restarts.
+			l.rxPos = 0u;
+			rxEvent(l, l.rxSize);
+			moved = false;
+		}
+	}
+	if(l.line.empty()){
+		l.rxCredit = 0.0;
+		if(moved) rxEvent(l, l.rxPos);	// Line Idle
+	}
+}
+
+void serviceTx(Link & l){
+	if(l.txSize == 0u) return;
+
+	l.txCredit += charsPerTick(l.huart);
+	if(l.txCredit >= l.txSize){
+		const auto data = l.txData;
+		const auto size = l.txSize;
+		l.txSize = 0u;
+		l.txCredit = 0.0;
+		l.huart->gState = HAL_UART_STATE_READY;
+		if(l.sink && mismatched(l)){
+			std::vector<uint8_t> g(data, data + size);
+			for(auto & c : g) c = garble(l, c);
+			l.sink(l.huart, g.data(), size, l.sinkCtx);
+		}
+		else if(l.sink) l.sink(l.huart, data, size, l.sinkCtx);
+		txCplt(l);
+	}
+}
+
+}
+
+/* Simulation Controls */
+
+void HAL_Sim::feed(UART_HandleTypeDef * huart, const uint8_t * data, size_t size){
+	auto & l = link(huart);
+	l.line.insert(l.line.end(), data, data + size);
+}
+
+size_t HAL_Sim::pending(UART_HandleTypeDef * huart){
+	return link(huart).line.size();
+}
+
+void HAL_Sim::setTxSink(UART_HandleTypeDef * huart, TxSink sink, void * ctx){
+	auto & l = link(huart);
+	l.sink = sink;
+	l.sinkCtx = ctx;
+}
+
+void HAL_Sim::setRemoteBaudrate(UART_HandleTypeDef * huart, uint32_t baud){
+	link(huart).remoteBaud = baud;
+}
+
+void HAL_Sim::advance(uint32_t ms){
+	while(ms-- > 0u){
+		tick++;
+		for(auto & l : links){
+			if(l.huart == nullptr) continue;
+			serviceTx(l);
+			serviceRx(l);
+		}
+	}
+}
+
+/* HAL Core */
+
+uint32_t HAL_GetTick(void){
+	return tick;
+}
+
+void HAL_Delay(uint32_t Delay){
+	HAL_Sim::advance(Delay + 1u);	// The ST HAL guarantees at least Delay ms by adding a tick.
+}
+
+/* HAL Cortex */
+
+void HAL_NVIC_EnableIRQ(IRQn_Type IRQn){
+	irqDisabled[IRQn] = false;
+
+	for(auto & l : links){	// Raise anything that became pending while disabled.
+		if( (l.huart == nullptr) || (irqOf(l.huart) != IRQn) ) continue;
+		if(l.txCpltPending){
+			l.txCpltPending = false;
+			HAL_UART_TxCpltCallback(l.huart);
+		}
+		if(l.rxEventPending){
+			l.rxEventPending = false;
+			HAL_UARTEx_RxEventCallback(l.huart, l.rxEventSize);
+		}
+	}
+}
+
+void HAL_NVIC_DisableIRQ(IRQn_Type IRQn){
+	irqDisabled[IRQn] = true;
+}
+
+/* HAL UART */
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart){
+	link(huart);
+	huart->gState = HAL_UART_STATE_READY;
+	huart->RxState = HAL_UART_STATE_READY;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart){
+	auto & l = link(huart);
+	l.rxActive = false;
+	l.txSize = 0u;
+	huart->gState = HAL_UART_STATE_RESET;
+	huart->RxState = HAL_UART_STATE_RESET;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size){
+	if(huart->gState != HAL_UART_STATE_READY) return HAL_BUSY;
+	if( (pData == nullptr) || (Size == 0u) ) return HAL_ERROR;
+
+	auto & l = link(huart);
+	l.txData = pData;	// Read upon completion, so the caller must keep the data in place as for a real DMA.
+	l.txSize = Size;
+	l.txCredit = 0.0;
+	huart->gState = HAL_UART_STATE_BUSY_TX;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_DMAStop(UART_HandleTypeDef *huart){
+	auto & l = link(huart);
+	l.rxActive = false;
+	l.txSize = 0u;
+	huart->gState = HAL_UART_STATE_READY;
+	huart->RxState = HAL_UART_STATE_READY;
+	return HAL_OK;
+}
+
+HAL_UART_StateTypeDef HAL_UART_GetState(const UART_HandleTypeDef *huart){
+	return huart->gState | huart->RxState;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size){
+	if(huart->RxState != HAL_UART_STATE_READY) return HAL_BUSY;
+	if( (pData == nullptr) || (Size == 0u) ) return HAL_ERROR;
+
+	auto & l = link(huart);
+	l.rxBuff = pData;
+	l.rxSize = Size;
+	l.rxPos = 0u;
+	l.rxActive = true;
+	huart->RxState = HAL_UART_STATE_BUSY_RX;
+	return HAL_OK;
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,218 @@
+/**
+  ******************************************************************************
+  * @file			: ack_tracker.cpp
+  * @brief			: Test of UBX-ACK Matching, Retries and Timeouts
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * First drives an AckTracker directly with a simulated tick, checking that responses match the oldest request of
+ * their class and ID, that timeouts retry and then expire, and that every request ends exactly once. Then drives the
+ * driver through the C API against a simulated receiver which acknowledges, rejects, drops or ignores each UBX-CFG-
+ * VALSET it is sent.
+ */
+
+#include "AckTracker.hpp"
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+/* AckTracker */
+
+struct Outcome{
+	int calls = 0;		// Completions. Must end at 1.
+	AckTracker::Result result = AckTracker::Result::UNSENT;
+	int resends = 0;
+	bool resendOk = true;
+};
+
+static void done(uint8_t, uint8_t, AckTracker::Result result, void * ctx){
+	auto o = static_cast<Outcome *>(ctx);
+	o->calls++;
+	o->result = result;
+}
+
+static bool resend(void * ctx){
+	auto o = static_cast<Outcome *>(ctx);
+	o->resends++;
+	return o->resendOk;
+}
+
+static AckTracker::Request request(Outcome & o, uint8_t msgID, uint8_t retries = 0u){
+	AckTracker::Request r;
+	r.msgClass = 0x06u;
+	r.msgID = msgID;
+	r.retries = retries;
+	r.timeout = 1000u;
+	r.done = done;
+	r.resend = resend;
+	r.ctx = &o;
+	return r;
+}
+
+static void tracker(){
+	AckTracker acks;
+	Outcome a, b, c;
+
+	// Matching: oldest first within a class and ID.
+	acks.submit(request(a, 0x8Au), 0u);
+	const AckTracker::Token tb = acks.submit(request(b, 0x8Au), 10u);
+	acks.submit(request(c, 0x8Bu), 20u);
+	check(acks.inFlight() == 3u, "Three requests in flight");
+	check(acks.resolve(true, 0x06u, 0x8Au) && (a.calls == 1) && (a.result == AckTracker::Result::ACK) && (b.calls == 0),
+		"ACK completes the oldest request of its class and ID");
+	check(acks.resolve(false, 0x06u, 0x8Bu) && (c.result == AckTracker::Result::NAK) && acks.pending(tb), "NAK completes its own request only");
+	check(!acks.resolve(true, 0x06u, 0x8Cu) && !acks.resolve(true, 0x05u, 0x8Au), "Unmatched responses are ignored");
+	acks.cancel(tb);
+	acks.cancel(tb);
+	check( (b.calls == 1) && (b.result == AckTracker::Result::CANCELLED) && (acks.inFlight() == 0u), "cancel() completes once");
+
+	// Timeout without retries, at the deadline and not before.
+	Outcome d;
+	acks.submit(request(d, 0x8Au), 1000u);
+	acks.service(1999u);
+	check(d.calls == 0, "No timeout before the deadline");
+	acks.service(2000u);
+	check( (d.calls == 1) && (d.result == AckTracker::Result::TIMEOUT) && (d.resends == 0), "Timeout at the deadline");
+
+	// Retries, then acknowledged.
+	Outcome e;
+	acks.submit(request(e, 0x8Au, 2u), 0u);
+	acks.service(1000u);
+	check( (e.resends == 1) && (e.calls == 0), "Timeout resends while retries remain");
+	acks.resolve(true, 0x06u, 0x8Au);
+	check( (e.calls == 1) && (e.result == AckTracker::Result::ACK), "A retried request is acknowledged");
+
+	// Retries exhausted.
+	Outcome f;
+	acks.submit(request(f, 0x8Au, 2u), 0u);
+	for(uint32_t t = 0u; t <= 5000u; t += 100u) acks.service(t);
+	check( (f.resends == 2) && (f.calls == 1) && (f.result == AckTracker::Result::TIMEOUT), "Timeout after all retries");
+
+	// A failed resend ends the request.
+	Outcome g;
+	g.resendOk = false;
+	acks.submit(request(g, 0x8Au, 2u), 0u);
+	acks.service(1000u);
+	check( (g.resends == 1) && (g.result == AckTracker::Result::TIMEOUT), "A failed resend times out");
+
+	// A retried request is matched after those already in flight.
+	Outcome h, i;
+	acks.submit(request(h, 0x8Au, 1u), 0u);
+	acks.submit(request(i, 0x8Au), 500u);
+	acks.service(1000u);	// h resent, now newer than i.
+	acks.resolve(false, 0x06u, 0x8Au);
+	check( (i.result == AckTracker::Result::NAK) && (h.calls == 0), "A retried request is matched after older requests");
+	acks.resolve(true, 0x06u, 0x8Au);
+
+	// Capacity, then clear().
+	Outcome full[AckTracker::capacity + 1];
+	bool accepted = true;
+	for(uint8_t k = 0u; k < AckTracker::capacity; k++) accepted &= (acks.submit(request(full[k], 0x8Au), 0u) != AckTracker::none);
+	check(accepted && acks.full() && (acks.submit(request(full[AckTracker::capacity], 0x8Au), 0u) == AckTracker::none),
+		"Full table refuses a request");
+	acks.clear();
+	int cancelled = 0;
+	for(uint8_t k = 0u; k < AckTracker::capacity; k++) cancelled += (full[k].calls == 1) && (full[k].result == AckTracker::Result::CANCELLED);
+	check( (cancelled == AckTracker::capacity) && (full[AckTracker::capacity].calls == 0) && (acks.inFlight() == 0u),
+		"clear() cancels every request once");
+}
+
+/* Driver, Against a Simulated Receiver */
+
+enum class Reply{ ACK, NAK, DROP_FIRST, NONE };
+static Reply reply = Reply::ACK;
+static int valsets = 0;	// UBX-CFG-VALSET frames transmitted.
+
+static void respond(bool ack){
+	uint8_t f[10] = {0xB5u, 0x62u, 0x05u, static_cast<uint8_t>(ack ? 0x01u : 0x00u), 2u, 0u, 0x06u, 0x8Au, 0u, 0u};
+	for(int k = 2; k < 8; k++){
+		f[8] += f[k];
+		f[9] += f[8];
+	}
+	HAL_Sim::feed(&huart4, f, sizeof(f));
+}
+
+static void receiver(UART_HandleTypeDef *, const uint8_t * d, uint16_t n, void *){
+	for(uint16_t k = 0u; k + 3u < n; k++){
+		if( (d[k] != 0xB5u) || (d[k+1] != 0x62u) || (d[k+2] != 0x06u) || (d[k+3] != 0x8Au) ) continue;
+		valsets++;
+		switch(reply){
+			case Reply::ACK:		respond(true); break;
+			case Reply::NAK:		respond(false); break;
+			case Reply::DROP_FIRST:	if(valsets > 1) respond(true); break;
+			case Reply::NONE:		break;
+		}
+	}
+}
+
+static UBX_MSG_t command(Reply r, int & sent){
+	reply = r;
+	valsets = 0;
+	const UBX_MSG_t result = GPS_UpdateRate_Config();
+	sent = valsets;
+	return result;
+}
+
+static void driver(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 38400u;
+	HAL_UART_Init(&huart4);
+	HAL_Sim::setTxSink(&huart4, receiver, nullptr);
+	GPS_Init();
+
+	int sent;
+	check( (command(Reply::ACK, sent) == UBX_ACK_ACK) && (sent == 1), "Acknowledged command");
+	check( (command(Reply::NAK, sent) == UBX_ACK_NACK) && (sent == 1), "Rejected command");
+	check( (command(Reply::DROP_FIRST, sent) == UBX_ACK_ACK) && (sent == 2), "Command retried once and acknowledged");
+	const uint32_t t0 = HAL_GetTick();
+	check( (command(Reply::NONE, sent) == UBX_TIMEOUT_Rx) && (sent == 3), "Command timed out after two retries");
+	check(HAL_GetTick() - t0 >= 3000u, "Each attempt waits for its timeout");
+
+	// Pipelined: ten commands in flight before any response.
+	reply = Reply::NONE;
+	static int acked = 0;
+	AckTracker::Request r;
+	r.done = [](uint8_t, uint8_t, AckTracker::Result result, void *){ if(result == AckTracker::Result::ACK) acked++; };
+	const UBX::CFG::VAL::SET set{ {CFG_PM_OPERATEMODE, UBX::CFG::VAL::CFG_PM_OPERATEMODE::FULL} };
+	bool queued = true;
+	for(int k = 0; k < 10; k++) queued &= (m9n.send(set, r) != AckTracker::none);
+	check(queued && (m9n.pending().inFlight() == 10u), "Ten commands in flight");
+	for(int k = 0; k < 10; k++) respond(true);
+	for(int k = 0; k < 50; k++){
+		HAL_Delay(5);
+		GPS_Update();
+	}
+	check( (acked == 10) && (m9n.pending().inFlight() == 0u), "Ten pipelined commands acknowledged");
+
+	// A full tracker: nothing is transmitted that could not be tracked.
+	bool tracked = true;
+	for(uint8_t k = 0u; k < AckTracker::capacity; k++) tracked &= (m9n.send(set, r) != AckTracker::none);
+	HAL_Delay(200);	// Until all have been clocked out.
+	const int before = valsets;
+	check(tracked && m9n.pending().full() && (m9n.send(set, r) == AckTracker::none), "A full tracker refuses a command");
+	HAL_Delay(200);
+	check(valsets == before, "A refused command is not transmitted");
+}
+
+int main(){
+	tracker();
+	driver();
+	return result();
+}
+
+/*** END OF FILE ***/
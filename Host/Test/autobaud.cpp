@@ -0,0 +1,125 @@
+/**
+  ******************************************************************************
+  * @file			: autobaud.cpp
+  * @brief			: Test of Discovery of the Receiver's Baudrate
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Boots the driver against a simulated receiver at 38400 Bd, then moves the receiver to another baudrate behind the
+ * driver's back with HAL_Sim::setRemoteBaudrate(), as a partial reconfiguration or brown-out would. The receiver only
+ * answers CFG-VALGET polls, which arrive garbled unless sent at its baudrate. autobaud() must lock in the receiver's
+ * baudrate, leave the link verified, and against a silent receiver must return to where it began without locking.
+ */
+
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+#include "UBX_ACK.hpp"
+
+#include <cstdio>
+#include <map>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+using Baud = M9N_Base::Baud;
+using Result = AckTracker::Result;
+
+/* Simulated Receiver */
+
+static std::map<uint32_t, uint32_t> config;	// Keys never set read as 1.
+static bool silent = false;
+
+static void moveTo(Baud b){
+	config[CFG_UART1_BAUDRATE.toKey()] = static_cast<uint32_t>(b);
+	HAL_Sim::setRemoteBaudrate(&huart4, static_cast<uint32_t>(b));
+}
+
+static void frame(uint8_t msgClass, uint8_t msgID, const std::vector<uint8_t> & payload){
+	std::vector<uint8_t> f(payload.size() + 8u);
+	UBX::Writer w(f.data(), msgClass, msgID, static_cast<UBX::U2>(payload.size()));
+	for(uint8_t c : payload) w.put(c);
+	w.finish();
+	HAL_Sim::feed(&huart4, f.data(), f.size());
+}
+
+static void receiver(UART_HandleTypeDef *, const uint8_t * d, uint16_t n, void *){
+	if( silent || (n < 8u) || (d[0] != 0xB5u) || (d[1] != 0x62u) || (d[2] != UBX::CFG::classID) ) return;
+	const uint16_t len = d[4] | (d[5] << 8);
+	const uint8_t * p = d + 6u;
+
+	if(d[3] == UBX::CFG::VAL::SET::ID){
+		for(uint16_t i = 4u; i + 4u <= len; ){
+			const uint32_t key = UBX::Field<uint32_t, 0>::get(p + i);
+			const uint8_t size = UBX::CFG::VAL::KeyID(key).valueSize();
+			uint32_t value = 0u;
+			for(uint8_t b = 0u; (b < size) && (b < 4u); b++) value |= static_cast<uint32_t>(p[i + 4u + b]) << (8u * b);
+			config[key] = value;
+			i += 4u + size;
+		}
+		frame(UBX::ACKNAK::classID, UBX::ACKNAK::ACK::ID, {UBX::CFG::classID, UBX::CFG::VAL::SET::ID});
+	}
+	else if(d[3] == UBX::CFG::VAL::GET::ID){
+		std::vector<uint8_t> polled = {0x01u, p[1], 0u, 0u};
+		for(uint16_t i = 4u; i + 4u <= len; i += 4u){
+			const uint32_t key = UBX::Field<uint32_t, 0>::get(p + i);
+			const uint32_t value = config.count(key) ? config[key] : 1u;
+			for(uint8_t b = 0u; b < 4u; b++) polled.push_back(static_cast<uint8_t>(key >> (8u * b)));
+			for(uint8_t b = 0u; b < UBX::CFG::VAL::KeyID(key).valueSize(); b++) polled.push_back( (b < 4u) ? static_cast<uint8_t>(value >> (8u * b)) : 0u );
+		}
+		frame(UBX::CFG::classID, UBX::CFG::VAL::GET::ID, polled);
+		frame(UBX::ACKNAK::classID, UBX::ACKNAK::ACK::ID, {UBX::CFG::classID, UBX::CFG::VAL::GET::ID});
+	}
+}
+
+static void discover(Baud receiverBaud){
+	moveTo(receiverBaud);
+	const auto a = m9n.autobaud();
+	printf("Receiver at %u Bd: found %u Bd, %u frames, in %u ms\n", static_cast<unsigned>(receiverBaud), static_cast<unsigned>(a.baud),
+		static_cast<unsigned>(a.frames), static_cast<unsigned>(a.elapsed));
+	check( a.locked && (a.baud == receiverBaud) && (m9n.baudrate() == receiverBaud) && (huart4.Init.BaudRate == static_cast<uint32_t>(receiverBaud)),
+		"Locks in the receiver's baudrate");
+	check(m9n.changeBaudrate(receiverBaud) == Result::ACK, "The link is verified afterwards");
+}
+
+int main(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 38400u;
+	HAL_UART_Init(&huart4);
+	HAL_Sim::setTxSink(&huart4, receiver, nullptr);
+	moveTo(Baud::B38400);
+	check(m9n.init() == Result::ACK, "Boots at 38400 Bd");
+
+	// Already at the receiver's baudrate: found within one window.
+	const auto a = m9n.autobaud();
+	check( a.locked && (a.baud == Baud::B38400) && (a.elapsed < M9N::autobaudWindow), "Locks in the baudrate in use first");
+
+	discover(Baud::B115200);
+	discover(Baud::B9600);
+	discover(Baud::B921600);
+
+	// Nothing heard at any baudrate.
+	silent = true;
+	const auto s = m9n.autobaud();
+	check(!s.locked && (s.baud == Baud::B921600) && (m9n.baudrate() == Baud::B921600), "A silent receiver leaves the baudrate as it was");
+	silent = false;
+
+	check(m9n.overruns() == 0u, "No characters lost to restarts of reception");
+
+	return result();
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,160 @@
+/**
+  ******************************************************************************
+  * @file			: baud_change.cpp
+  * @brief			: Test of Verified Baudrate Changes and Escalation
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * A simulated receiver answers CFG-VALGET polls, and switches its own baudrate once it has received a CFG-VALSET of
+ * CFG-UART1-BAUDRATE or a PUBX,41, with HAL_Sim::setRemoteBaudrate() so that characters at differing baudrates are
+ * garbled. Above stableMax it corrupts every reply, as a marginal link would. Escalation must stop at stableMax with
+ * both ends agreeing, a change which the receiver ignores must be reverted with the link intact, and a PUBX,41 must
+ * reach the receiver whole before the MCU switches. Probes must not depend on, nor disturb, the configuration shadow.
+ */
+
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+#include "UBX_ACK.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+using Baud = M9N_Base::Baud;
+using Result = AckTracker::Result;
+
+/* Simulated Receiver */
+
+static std::map<uint32_t, uint32_t> config;		// Keys never set read as 1.
+static uint32_t remote = 38400u;				// The receiver's baudrate.
+static const uint32_t stableMax = 230400u;		// Fastest baudrate at which replies arrive intact.
+static bool ignoreBaudrate = false;				// Ignore changes of baudrate.
+static bool pubxWhole = false;					// The last PUBX,41 arrived with a valid checksum.
+
+static void switchTo(uint32_t baud){
+	if(ignoreBaudrate) return;
+	remote = baud;
+	config[CFG_UART1_BAUDRATE.toKey()] = baud;
+	HAL_Sim::setRemoteBaudrate(&huart4, baud);
+}
+
+static void frame(uint8_t msgClass, uint8_t msgID, const std::vector<uint8_t> & payload){
+	std::vector<uint8_t> f(payload.size() + 8u);
+	UBX::Writer w(f.data(), msgClass, msgID, static_cast<UBX::U2>(payload.size()));
+	for(uint8_t c : payload) w.put(c);
+	w.finish();
+	if(remote > stableMax) f[6] ^= 0x10u;
+	HAL_Sim::feed(&huart4, f.data(), f.size());
+}
+
+static void pubx(const char * s, uint16_t n){
+	const char * ast = static_cast<const char *>(memchr(s, '*', n));
+	if(ast == nullptr) return;
+	uint8_t cs = 0u;
+	for(const char * c = s + 1; c < ast; c++) cs ^= *c;
+	pubxWhole = (strtoul(ast + 1, nullptr, 16) == cs);
+	if(pubxWhole) switchTo(strtoul(s + 21, nullptr, 10));	// "$PUBX,41,p,iiii,oooo,bbbbbb"
+}
+
+static void receiver(UART_HandleTypeDef *, const uint8_t * d, uint16_t n, void *){
+	if( (n > 28u) && (memcmp(d, "$PUBX,41,", 9) == 0) ) return pubx(reinterpret_cast<const char *>(d), n);
+	if( (n < 8u) || (d[0] != 0xB5u) || (d[1] != 0x62u) || (d[2] != UBX::CFG::classID) ) return;
+	const uint16_t len = d[4] | (d[5] << 8);
+	const uint8_t * p = d + 6u;
+
+	if(d[3] == UBX::CFG::VAL::SET::ID){
+		uint32_t baud = 0u;
+		for(uint16_t i = 4u; i + 4u <= len; ){
+			const uint32_t key = UBX::Field<uint32_t, 0>::get(p + i);
+			const uint8_t size = UBX::CFG::VAL::KeyID(key).valueSize();
+			uint32_t value = 0u;
+			for(uint8_t b = 0u; (b < size) && (b < 4u); b++) value |= static_cast<uint32_t>(p[i + 4u + b]) << (8u * b);
+			if(key == CFG_UART1_BAUDRATE.toKey()) baud = value;
+			else config[key] = value;
+			i += 4u + size;
+		}
+		if(baud) switchTo(baud);	// Any acknowledgement would be lost in the change.
+		else frame(UBX::ACKNAK::classID, UBX::ACKNAK::ACK::ID, {UBX::CFG::classID, UBX::CFG::VAL::SET::ID});
+	}
+	else if(d[3] == UBX::CFG::VAL::GET::ID){
+		std::vector<uint8_t> polled = {0x01u, p[1], 0u, 0u};
+		for(uint16_t i = 4u; i + 4u <= len; i += 4u){
+			const uint32_t key = UBX::Field<uint32_t, 0>::get(p + i);
+			const uint32_t value = config.count(key) ? config[key] : 1u;
+			for(uint8_t b = 0u; b < 4u; b++) polled.push_back(static_cast<uint8_t>(key >> (8u * b)));
+			for(uint8_t b = 0u; b < UBX::CFG::VAL::KeyID(key).valueSize(); b++) polled.push_back( (b < 4u) ? static_cast<uint8_t>(value >> (8u * b)) : 0u );
+		}
+		frame(UBX::CFG::classID, UBX::CFG::VAL::GET::ID, polled);
+		frame(UBX::ACKNAK::classID, UBX::ACKNAK::ACK::ID, {UBX::CFG::classID, UBX::CFG::VAL::GET::ID});
+	}
+}
+
+static bool agree(Baud b){
+	return (m9n.baudrate() == b) && (huart4.Init.BaudRate == static_cast<uint32_t>(b)) && (remote == static_cast<uint32_t>(b));
+}
+
+int main(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 38400u;
+	HAL_UART_Init(&huart4);
+	HAL_Sim::setTxSink(&huart4, receiver, nullptr);
+	HAL_Sim::setRemoteBaudrate(&huart4, remote);
+	config[CFG_UART1_BAUDRATE.toKey()] = remote;
+
+	check( (m9n.init() == Result::ACK) && agree(Baud::B38400), "Boots at 38400 Bd");
+	check( (m9n.changeBaudrate(Baud::B38400) == Result::ACK), "The link at the current baudrate is verified");
+
+	// Escalation stops at the fastest stable baudrate.
+	const uint32_t t0 = HAL_GetTick();
+	const Baud b = m9n.escalate(Baud::B921600);
+	printf("Escalated to %u Bd in %u ms\n", static_cast<unsigned>(b), static_cast<unsigned>(HAL_GetTick() - t0));
+	check( (b == Baud::B230400) && agree(Baud::B230400), "Escalation stops at the fastest stable baudrate");
+	check(m9n.changeBaudrate(Baud::B230400) == Result::ACK, "The link survives the failed step");
+
+	// A change which the receiver ignores is reverted.
+	ignoreBaudrate = true;
+	check( (m9n.changeBaudrate(Baud::B460800) != Result::ACK) && agree(Baud::B230400), "An ignored change is reverted");
+	ignoreBaudrate = false;
+	check(m9n.changeBaudrate(Baud::B230400) == Result::ACK, "The link survives the reverted change");
+
+	check( (m9n.changeBaudrate(Baud::B115200) == Result::ACK) && agree(Baud::B115200), "Steps down");
+	check( (m9n.escalate(Baud::B115200) == Baud::B115200) && agree(Baud::B115200), "Escalation respects its ceiling");
+
+	// PUBX,41 must leave at the old baudrate before the MCU switches.
+	m9n.setConfig({M9N_Base::PortID::UART1, M9N_Base::InProto::UBX, M9N_Base::OutProto::UBX, Baud::B38400, false});
+	check(pubxWhole && agree(Baud::B38400), "PUBX,41 received whole before the MCU switches");
+	check(m9n.changeBaudrate(Baud::B38400) == Result::ACK, "The link survives PUBX,41");
+	check(m9n.overruns() == 0u, "No characters lost to restarts of reception");
+
+	// Probes with the shadow full of other keys.
+	std::vector<UBX::CFG::VAL::KeyValuePair> kv;
+	for(uint16_t i = 1u; i <= ConfigShadow::capacity; i++) kv.push_back({UBX::CFG::VAL::Key<UBX::U1>(0x20910000u | i), static_cast<UBX::U1>(1u)});
+	check( (m9n.apply(kv.data(), kv.data() + kv.size()) == Result::ACK) && (m9n.configuration().size() == ConfigShadow::capacity),
+		"The shadow is filled");
+	check(m9n.changeBaudrate(Baud::B38400) == Result::ACK, "The link is verified with the shadow full");
+	UBX::U4 v;
+	check(!m9n.configuration().lookup(CFG_UART1_BAUDRATE.toKey(), v) && m9n.configuration().matches(kv.back()),
+		"Probes leave the shadow as it was");
+
+	return result();
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,187 @@
+/**
+  ******************************************************************************
+  * @file			: config_shadow.cpp
+  * @brief			: Test of the Configuration Shadow and Differential Boot Configuration
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * First checks the ConfigShadow table and profile hash directly. Then boots the driver repeatedly against a simulated
+ * receiver which holds its own configuration, answering CFG-VALGET polls from it and applying each CFG-VALSET. The
+ * first boot must set only the keys whose values differ, a second boot none, a boot with an unchanged digest must
+ * neither poll nor set, and a boot after one key has drifted must set that key alone. Profiles applied to RAM and BBR
+ * must be diffed against each layer, and a rejected poll must be returned without anything being set.
+ */
+
+#include "Check.hpp"
+#include "ConfigShadow.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+#include "UBX_ACK.hpp"
+
+#include <cstdio>
+#include <map>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+using KeyValuePair = UBX::CFG::VAL::KeyValuePair;
+
+/* ConfigShadow */
+
+static void shadow(){
+	ConfigShadow s;
+	UBX::U4 v = 0u;
+	check(!s.lookup(CFG_RATE_MEAS.toKey(), v) && (s.size() == 0u), "Empty shadow");
+
+	s.store(CFG_RATE_MEAS.toKey(), 100u);
+	s.store(CFG_RATE_MEAS.toKey(), 200u);
+	check(s.lookup(CFG_RATE_MEAS.toKey(), v) && (v == 200u) && (s.size() == 1u), "A stored key is updated in place");
+	check(s.matches({CFG_RATE_MEAS, static_cast<UBX::U2>(200u)}) && !s.matches({CFG_RATE_MEAS, static_cast<UBX::U2>(100u)})
+		&& !s.matches({CFG_RATE_NAV, static_cast<UBX::U2>(200u)}), "matches() compares key and value");
+
+	// Fill with distinct keys (item IDs of one group), then one more.
+	s.clear();
+	bool stored = true;
+	for(uint16_t i = 1u; i <= ConfigShadow::capacity; i++) stored &= s.store(0x20910000u | i, i);
+	check(stored && (s.size() == ConfigShadow::capacity), "Holds capacity keys");
+	check(!s.store(0x20910000u | (ConfigShadow::capacity + 1u), 0u) && s.store(0x20910001u, 7u), "Full: new keys refused, held keys updated");
+	bool found = true;
+	for(uint16_t i = 2u; i <= ConfigShadow::capacity; i++) found &= s.lookup(0x20910000u | i, v) && (v == i);
+	check(found && s.lookup(0x20910001u, v) && (v == 7u), "Every held key found");
+	s.clear();
+	check( (s.size() == 0u) && !s.lookup(0x20910001u, v), "clear() empties the shadow");
+
+	// Profile hash.
+	const KeyValuePair a[] = { {CFG_RATE_MEAS, static_cast<UBX::U2>(100u)}, {CFG_RATE_NAV, static_cast<UBX::U2>(1u)} };
+	const KeyValuePair b[] = { {CFG_RATE_MEAS, static_cast<UBX::U2>(100u)}, {CFG_RATE_NAV, static_cast<UBX::U2>(1u)} };
+	const KeyValuePair c[] = { {CFG_RATE_MEAS, static_cast<UBX::U2>(100u)}, {CFG_RATE_NAV, static_cast<UBX::U2>(2u)} };
+	const KeyValuePair d[] = { {CFG_RATE_NAV, static_cast<UBX::U2>(1u)}, {CFG_RATE_MEAS, static_cast<UBX::U2>(100u)} };
+	const uint32_t h = ConfigShadow::hash(std::begin(a), std::end(a));
+	check( (h == ConfigShadow::hash(std::begin(b), std::end(b))) && (h != ConfigShadow::hash(std::begin(c), std::end(c)))
+		&& (h != ConfigShadow::hash(std::begin(d), std::end(d))), "hash() depends on every key, value and their order");
+}
+
+/* Driver, Against a Simulated Receiver */
+
+static std::map<uint32_t, uint32_t> layer[3];	// The receiver's RAM, BBR and flash. Keys never set read as 1 in RAM.
+static std::map<uint32_t, uint32_t> & config = layer[0];
+static const uint32_t unknown = 0x209100FFu;	// A key the receiver rejects.
+static int polls = 0, sets = 0, keysPolled = 0, keysSet = 0;
+
+static void frame(uint8_t msgClass, uint8_t msgID, const std::vector<uint8_t> & payload){
+	std::vector<uint8_t> f(payload.size() + 8u);
+	UBX::Writer w(f.data(), msgClass, msgID, static_cast<UBX::U2>(payload.size()));
+	for(uint8_t c : payload) w.put(c);
+	w.finish();
+	HAL_Sim::feed(&huart4, f.data(), f.size());
+}
+
+static void receiver(UART_HandleTypeDef *, const uint8_t * d, uint16_t n, void *){
+	if( (n < 8u) || (d[0] != 0xB5u) || (d[2] != UBX::CFG::classID) ) return;
+	const uint16_t len = d[4] | (d[5] << 8);
+	const uint8_t * p = d + 6u;
+
+	if(d[3] == UBX::CFG::VAL::SET::ID){
+		sets++;
+		for(uint16_t i = 4u; i + 4u <= len; ){
+			const uint32_t key = UBX::Field<uint32_t, 0>::get(p + i);
+			const uint8_t size = UBX::CFG::VAL::KeyID(key).valueSize();
+			uint32_t value = 0u;
+			for(uint8_t b = 0u; (b < size) && (b < 4u); b++) value |= static_cast<uint32_t>(p[i + 4u + b]) << (8u * b);
+			for(uint8_t l = 0u; l < 3u; l++) if(p[1] & (1u << l)) layer[l][key] = value;
+			keysSet++;
+			i += 4u + size;
+		}
+		frame(UBX::ACKNAK::classID, UBX::ACKNAK::ACK::ID, {UBX::CFG::classID, UBX::CFG::VAL::SET::ID});
+	}
+	else if(d[3] == UBX::CFG::VAL::GET::ID){
+		polls++;
+		std::vector<uint8_t> polled = {0x01u, p[1], 0u, 0u};	// Version, layer, position.
+		auto & held = layer[p[1]];
+		for(uint16_t i = 4u; i + 4u <= len; i += 4u){
+			const uint32_t key = UBX::Field<uint32_t, 0>::get(p + i);
+			if(key == unknown){
+				frame(UBX::ACKNAK::classID, UBX::ACKNAK::NAK::ID, {UBX::CFG::classID, UBX::CFG::VAL::GET::ID});
+				return;
+			}
+			if( (p[1] != 0u) && !held.count(key) ) continue;	// Not stored in this layer.
+			const uint32_t value = held.count(key) ? held[key] : 1u;
+			keysPolled++;
+			for(uint8_t b = 0u; b < 4u; b++) polled.push_back(static_cast<uint8_t>(key >> (8u * b)));
+			for(uint8_t b = 0u; b < UBX::CFG::VAL::KeyID(key).valueSize(); b++) polled.push_back( (b < 4u) ? static_cast<uint8_t>(value >> (8u * b)) : 0u );
+		}
+		frame(UBX::CFG::classID, UBX::CFG::VAL::GET::ID, polled);
+		frame(UBX::ACKNAK::classID, UBX::ACKNAK::ACK::ID, {UBX::CFG::classID, UBX::CFG::VAL::GET::ID});
+	}
+}
+
+static AckTracker::Result boot(uint32_t * digest){
+	polls = sets = keysPolled = keysSet = 0;
+	return m9n.init(digest);
+}
+
+static void driver(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 38400u;
+	HAL_UART_Init(&huart4);
+	HAL_Sim::setTxSink(&huart4, receiver, nullptr);
+
+	uint32_t digest = 0u;
+	check( (boot(&digest) == AckTracker::Result::ACK) && (polls > 0) && (sets > 0) && (keysSet > 0) && (digest != 0u),
+		"First boot polls, then sets the keys which differ");
+	printf("First boot: %d keys polled, %d set\n", keysPolled, keysSet);
+	check(keysSet < keysPolled, "Keys already at their values not set");
+
+	const uint32_t first = digest;
+	check( (boot(nullptr) == AckTracker::Result::ACK) && (polls > 0) && (sets == 0), "Second boot polls and sets nothing");
+	check( (boot(&digest) == AckTracker::Result::ACK) && (polls == 0) && (sets == 0) && (digest == first),
+		"Unchanged digest: no poll, no set");
+
+	config[CFG_MSGOUT_NMEA_ID_GSA_UART1.toKey()] = 5u;	// Changed behind the driver's back.
+	check( (boot(nullptr) == AckTracker::Result::ACK) && (sets == 1) && (keysSet == 1), "One drifted key set alone");
+	check(config[CFG_MSGOUT_NMEA_ID_GSA_UART1.toKey()] != 5u, "Drifted key restored");
+
+	// RAM and BBR: each layer diffed on its own.
+	using Layers = UBX::CFG::VAL::SET::Layers;
+	const KeyValuePair rate[] = { {CFG_RATE_MEAS, static_cast<UBX::U2>(200u)} };
+	layer[1][CFG_RATE_MEAS.toKey()] = 200u;	// Already persisted, but not in effect.
+	config[CFG_RATE_MEAS.toKey()] = 1000u;
+	polls = sets = keysPolled = keysSet = 0;
+	check( (m9n.apply(std::begin(rate), std::end(rate), static_cast<Layers>(0x03u)) == AckTracker::Result::ACK)
+		&& (polls == 2) && (sets == 1) && (config[CFG_RATE_MEAS.toKey()] == 200u), "RAM set although BBR matches");
+	check(m9n.configuration().matches(rate[0]), "The shadow holds RAM's values");
+
+	layer[1].clear();
+	config[CFG_RATE_MEAS.toKey()] = 200u;
+	polls = sets = keysPolled = keysSet = 0;
+	check( (m9n.apply(std::begin(rate), std::end(rate), static_cast<Layers>(0x03u)) == AckTracker::Result::ACK)
+		&& (sets == 1) && (layer[1][CFG_RATE_MEAS.toKey()] == 200u), "BBR set although RAM matches");
+
+	// A rejected poll.
+	const KeyValuePair bad[] = { {CFG_RATE_MEAS, static_cast<UBX::U2>(500u)}, {UBX::CFG::VAL::Key<UBX::U1>(unknown), static_cast<UBX::U1>(1u)} };
+	uint32_t digest2 = 0u;
+	polls = sets = keysPolled = keysSet = 0;
+	check( (m9n.apply(std::begin(bad), std::end(bad), Layers::RAM, &digest2) == AckTracker::Result::NAK) && (sets == 0)
+		&& (digest2 == 0u), "A rejected poll is returned, with nothing set");
+}
+
+int main(){
+	shadow();
+	driver();
+	return result();
+}
+
+/*** END OF FILE ***/
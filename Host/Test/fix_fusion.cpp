@@ -0,0 +1,120 @@
+/**
+  ******************************************************************************
+  * @file			: fix_fusion.cpp
+  * @brief			: Test of the Fusion of GGA, RMC and VTG into One Fix per Epoch
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Passes sequences of GGA, RMC and VTG sentences to a FixFusion. The sentences of one UTC time must be merged into a
+ * single Fix, made current only once the required set is complete, with the fields of each from the sentence which
+ * carries them. A repeated sentence must be ignored, a record left incomplete by a new time must be counted and never
+ * made current, and VTG must only supply the speed and course in the absence of RMC. Then replays the standard capture
+ * through the driver, which must publish each fix to the C API.
+ */
+
+#include "Capture.hpp"
+#include "Check.hpp"
+#include "FixFusion.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+
+#include <cstdio>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+/**
+ * @return true if the sentence completed the record.
+ */
+template<typename M>
+static bool receive(FixFusion & fusion, const char * body){
+	const std::string s = Capture::sentence(body);
+	return fusion.receive(M{StaticString(s.c_str())});
+}
+
+static void merge(){
+	typedef NMEA_Standard N;
+	FixFusion fusion;	// GGA and RMC required.
+
+	// RMC, VTG and GGA of one epoch, in the receiver's order.
+	check(!receive<N::RMC>(fusion, "GNRMC,092300.00,A,4717.11399,N,00833.91590,E,1.000,77.52,091222,,,A,V")
+		&& !receive<N::VTG>(fusion, "GNVTG,80.00,T,,M,2.000,N,3.704,K,A") && (fusion.current().parts == 0u), "Incomplete record not made current");
+	check(receive<N::GGA>(fusion, "GNGGA,092300.00,4717.11399,N,00833.91590,E,1,08,1.01,499.6,M,48.0,M,,"), "GGA completes the record");
+
+	const auto & f = fusion.current();
+	check( (f.parts == (FixFusion::GGA | FixFusion::RMC | FixFusion::VTG)) && (f.time.hh == 9u) && (f.time.mm == 23u) && (f.time.ss == 0u)
+		&& (f.time.year == 2022u) && (f.time.month == 12u) && (f.time.day == 9u), "Time and date of the epoch");
+	check( (f.lat == 472852332) && (f.lon == 85652650) && (f.alt == 499600) && (f.sep == 48000) && (f.hdop == 101u)
+		&& (f.quality == 1u) && (f.numSV == 8u), "Position and quality from GGA");
+	check( (f.speed == 514) && (f.course == 7752000) && (f.status == 'A') && (f.posMode == 'A'), "Speed and course from RMC, not VTG");
+
+	// A repeated sentence of a completed epoch is ignored.
+	check(!receive<N::GGA>(fusion, "GNGGA,092300.00,4717.11399,N,00833.91590,E,1,09,1.01,499.6,M,48.0,M,,") && (fusion.current().numSV == 8u),
+		"A repeated sentence is ignored");
+
+	// An epoch left incomplete by the next is counted, and never made current.
+	receive<N::RMC>(fusion, "GNRMC,092301.00,A,4717.11399,N,00833.91590,E,1.000,77.52,091222,,,A,V");
+	receive<N::VTG>(fusion, "GNVTG,80.00,T,,M,2.000,N,3.704,K,A");
+	check(!receive<N::GGA>(fusion, "GNGGA,092302.00,4717.11399,N,00833.91590,E,1,09,1.01,500.6,M,48.0,M,,") && (fusion.incomplete() == 1u)
+		&& (fusion.current().time.ss == 0u), "An incomplete epoch is counted and not made current");
+	check(receive<N::RMC>(fusion, "GNRMC,092302.00,A,4717.11399,N,00833.91590,E,0.000,,091222,,,A,V") && (fusion.current().time.ss == 2u)
+		&& (fusion.current().alt == 500600) && (fusion.current().numSV == 9u), "The next epoch completes");
+
+	// VTG outside of an epoch being assembled is ignored.
+	check(!receive<N::VTG>(fusion, "GNVTG,80.00,T,,M,2.000,N,3.704,K,A") && (fusion.current().speed == 0), "VTG after completion is ignored");
+}
+
+static void withoutRMC(){
+	typedef NMEA_Standard N;
+	FixFusion fusion(FixFusion::GGA | FixFusion::VTG);
+
+	check(!receive<N::GGA>(fusion, "GNGGA,092300.00,4717.11399,N,00833.91590,E,1,08,1.01,499.6,M,48.0,M,,")
+		&& receive<N::VTG>(fusion, "GNVTG,80.00,T,,M,2.000,N,3.704,K,A"), "GGA and VTG complete a record when required");
+	const auto & f = fusion.current();
+	check( (f.speed == 1028) && (f.course == 8000000) && (f.posMode == 'A') && (f.time.year == 0u) && (f.status == 'V'),
+		"Speed and course from VTG without RMC");
+}
+
+static void driver(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 38400u;
+	HAL_UART_Init(&huart4);
+	GPS_Init();	// No receiver: the boot configuration times out.
+
+	const Capture::Stream c = Capture::nmea(3u);
+	HAL_Sim::feed(&huart4, c.data(), c.size());
+	for(int k = 0; k < 200; k++){
+		HAL_Delay(5);
+		GPS_Update();
+	}
+	const auto & p = gpsDataLive.coordinates;
+	printf("Capture: lat %ld lon %ld alt %ld speed %ld course %ld time %lu\n", static_cast<long>(p.lat), static_cast<long>(p.longi),
+		static_cast<long>(p.alt), static_cast<long>(p.speed), static_cast<long>(p.course), static_cast<unsigned long>(p.time));
+	check( (m9n.fix().current().time.ss == 2u) && (m9n.fix().incomplete() == 0u), "Every epoch of the capture fused");
+	const auto & f = m9n.fix().current();
+	check( (f.lat == 472852332) && (f.lon == 85652650) && (f.alt == 499600) && (f.quality == 1u) && (f.status == 'A'), "Position of the capture");
+	check( (p.alt == 499600) && (p.speed == 2) && (p.course == 7752000) && (gpsDataLive.diag.fix_quality == 1u),
+		"Fix published to the C API");	// The position is published again from GLL.
+	check(p.time == 1670577782u, "Time of the last epoch published: 2022-12-09 09:23:02 UTC");
+}
+
+int main(){
+	merge();
+	withoutRMC();
+	driver();
+	return result();
+}
+
+/*** END OF FILE ***/
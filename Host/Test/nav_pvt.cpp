@@ -0,0 +1,147 @@
+/**
+  ******************************************************************************
+  * @file			: nav_pvt.cpp
+  * @brief			: Test of the UBX-NAV-PVT View and its Publication
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Builds a NAV-PVT frame with the Field setters, as the receiver would send it, at an odd address so that every
+ * multi-byte field is unaligned, and reads each field back through UBX::NAV::PVT. Frames of another message, or
+ * shorter than the message, must leave the view invalid. The epoch must be published to gpsDataLive with the same coordinates as the equivalent GLL sentence, and
+ * the CFG-VALSET enabling NAV-PVT must be a complete frame.
+ */
+
+#include "Capture.hpp"
+#include "Check.hpp"
+#include "M9N_C_API.hpp"
+#include "UBX_CFG.hpp"
+#include "UBX_NAV.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+typedef UBX::NAV::PVT PVT;
+
+static void finish(std::vector<uint8_t> & f){
+	uint8_t ckA = 0u, ckB = 0u;
+	for(size_t i = 2u; i + 2u < f.size(); i++){
+		ckA += f[i];
+		ckB += ckA;
+	}
+	f[f.size() - 2u] = ckA;
+	f[f.size() - 1u] = ckB;
+}
+
+/**
+ * @brief A NAV-PVT frame of 2022-12-09 09:23:00 UTC at the position of the capture's GLL sentence.
+ */
+static std::vector<uint8_t> frame(){
+	std::vector<uint8_t> f(PVT::payloadLen + 8u, 0u);
+	f[0] = 0xB5u; f[1] = 0x62u; f[2] = UBX::NAV::classID; f[3] = PVT::ID;
+	UBX::Field<UBX::U2, 4>::set(f.data(), PVT::payloadLen);
+
+	uint8_t * p = f.data() + 6u;
+	PVT::iTOW.set(p, 465798000u);
+	PVT::year.set(p, 2022u);
+	PVT::month.set(p, 12u);
+	PVT::day.set(p, 9u);
+	PVT::hour.set(p, 9u);
+	PVT::min.set(p, 23u);
+	PVT::sec.set(p, 0u);
+	PVT::validFlags.set(p, 0x07u);	// validDate, validTime, fullyResolved
+	PVT::tAcc.set(p, 25u);
+	PVT::nano.set(p, -123456);
+	PVT::fixType.set(p, static_cast<UBX::E1>(PVT::FixType::FIX_3D));
+	PVT::flags.set(p, 0x01u);		// gnssFixOK
+	PVT::numSV.set(p, 8u);
+	PVT::lon.set(p, 85652608);		// 008 deg 33.91565 min E
+	PVT::lat.set(p, 472852273);		// 47 deg 17.11364 min N
+	PVT::height.set(p, 547600);
+	PVT::hMSL.set(p, 499600);
+	PVT::hAcc.set(p, 1800u);
+	PVT::vAcc.set(p, 2500u);
+	PVT::velN.set(p, 152);
+	PVT::velE.set(p, -37);
+	PVT::velD.set(p, 4);
+	PVT::gSpeed.set(p, 156);
+	PVT::headMot.set(p, 7752000);
+	PVT::sAcc.set(p, 300u);
+	PVT::headAcc.set(p, 1800000u);
+	PVT::pDOP.set(p, 194u);
+	PVT::magDec.set(p, -215);
+	finish(f);
+	return f;
+}
+
+int main(){
+	setenv("TZ", "UTC", 1);	// epoch() converts with mktime().
+
+	const std::vector<uint8_t> f = frame();
+	std::vector<uint8_t> odd(f.size() + 1u);
+	memcpy(odd.data() + 1u, f.data(), f.size());
+	const PVT pvt{odd.data() + 1u, odd.data() + 1u + f.size()};
+
+	check(pvt.valid(), "A NAV-PVT frame is viewed");
+	check( (pvt.get(PVT::iTOW) == 465798000u) && (pvt.get(PVT::year) == 2022u) && (pvt.get(PVT::month) == 12u)
+		&& (pvt.get(PVT::day) == 9u) && (pvt.get(PVT::hour) == 9u) && (pvt.get(PVT::min) == 23u) && (pvt.get(PVT::sec) == 0u)
+		&& (pvt.get(PVT::tAcc) == 25u) && (pvt.get(PVT::nano) == -123456), "Time fields");
+	check(pvt.validDate() && pvt.validTime() && pvt.fullyResolved() && (pvt.epoch() == 1670577780), "Time validity and epoch");
+	check( (pvt.get(PVT::fixType) == static_cast<UBX::E1>(PVT::FixType::FIX_3D)) && pvt.gnssFixOK()
+		&& (pvt.get(PVT::numSV) == 8u) && (pvt.get(PVT::pDOP) == 194u) && !pvt.invalidLlh(), "Fix fields");
+	check( (pvt.get(PVT::lon) == 85652608) && (pvt.get(PVT::lat) == 472852273) && (pvt.get(PVT::height) == 547600)
+		&& (pvt.get(PVT::hMSL) == 499600) && (pvt.get(PVT::hAcc) == 1800u) && (pvt.get(PVT::vAcc) == 2500u), "Position fields");
+	check( (pvt.get(PVT::velN) == 152) && (pvt.get(PVT::velE) == -37) && (pvt.get(PVT::velD) == 4)
+		&& (pvt.get(PVT::gSpeed) == 156) && (pvt.get(PVT::headMot) == 7752000) && (pvt.get(PVT::sAcc) == 300u)
+		&& (pvt.get(PVT::headAcc) == 1800000u) && (pvt.get(PVT::magDec) == -215), "Velocity fields");
+
+	std::vector<uint8_t> other = f;
+	other[3] = 0x03u;		// NAV-STATUS
+	std::vector<uint8_t> longer(f.begin(), f.end() - 2u);
+	longer.insert(longer.end(), 4u + 2u, 0u);	// Four more payload bytes, then the checksum.
+	UBX::Field<UBX::U2, 4>::set(longer.data(), PVT::payloadLen + 4u);
+	finish(longer);
+	check( !PVT{f.data(), f.data() + f.size() - 1u}.valid() && !PVT{other.data(), other.data() + other.size()}.valid(),
+		"Frames of another length or message are not viewed");
+	check(PVT{longer.data(), longer.data() + longer.size()}.valid(), "A longer payload of a later version is viewed");
+
+	/* Publication, against the equivalent GLL sentence */
+	const std::string gll = Capture::sentence("GNGLL,4717.11364,N,00833.91565,E,092300.00,A,A");
+	receiveGLL(NMEA_Standard::GLL(StaticString(gll.c_str())));
+	const int32_t lat = gpsDataLive.coordinates.lat, lon = gpsDataLive.coordinates.longi;
+	gpsDataLive = {};
+	receivePVT(pvt);
+	check( (gpsDataLive.coordinates.lat == lat) && (gpsDataLive.coordinates.longi == lon) && (lat == 472852273),
+		"Coordinates are published as from GLL");
+	check( (gpsDataLive.coordinates.time == 1670577780) && (gpsDataLive.diag.num_sats == 8) && (gpsDataLive.diag.fix_type == 3)
+		&& (gpsDataLive.diag.PDOP == 194u), "Time and fix are published");
+
+	/* The CFG-VALSET enabling NAV-PVT */
+	UBX::CFG::VAL::SET set{ {CFG_MSGOUT_UBX_NAV_PVT_UART1, static_cast<UBX::U1>(1u)} };
+	set.push({CFG_MSGOUT_NMEA_ID_GLL_UART1, static_cast<UBX::U1>(0u)});
+	std::vector<uint8_t> v(set.frameSize());
+	const auto n = set.serialize(v.data());
+	const std::vector<uint8_t> unfinished = v;
+	finish(v);
+	check( (n == 8u + 4u + 2u * 5u) && (v[2] == 0x06u) && (v[3] == 0x8Au) && (v[4] == n - 8u) && (v[5] == 0u)
+		&& (v == unfinished), "CFG-VALSET is a complete frame");
+
+	return result();
+}
+
+/*** END OF FILE ***/
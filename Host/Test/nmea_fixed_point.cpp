@@ -0,0 +1,103 @@
+/**
+  ******************************************************************************
+  * @file			: nmea_fixed_point.cpp
+  * @brief			: Test of the Fixed-Point NMEA Field and Coordinate Decoders
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Decodes (d)ddmm.mmmmm coordinates to degrees x 1e7, which must be rounded to the nearest unit and negative South and
+ * West. Then decodes DOPs x 100, altitudes in mm and speeds in mm/s with Field::scaled(), which must truncate surplus
+ * fractional digits towards zero, and must reject any field out of range of its type while leaving the value unchanged.
+ */
+
+#include "Check.hpp"
+#include "M9N_C_API.hpp"
+#include "NMEA_Standard.hpp"
+
+#include <cstdint>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+// Exposes the protected decoders of NMEA_Standard.
+struct Decoders : public NMEA_Standard{
+	using NMEA_Standard::Coordinate;
+	using NMEA_Standard::Field;
+
+	string toString(char * buff) override { return ""; }
+};
+
+using Coordinate = Decoders::Coordinate;
+using Field = Decoders::Field;
+
+template<typename T>
+static bool scaled(const char * f, uint8_t decimals, T expected){
+	T v = 0;
+	return Field::scaled(StaticString(f), decimals, v) && (v == expected);
+}
+
+template<typename T>
+static bool rejected(const char * f, uint8_t decimals){
+	T v = 42;
+	return !Field::scaled(StaticString(f), decimals, v) && (v == 42);
+}
+
+static int32_t deg7(const char * s, char nsew){
+	return Coordinate(StaticString(s), nsew);
+}
+
+static void coordinates(){
+	check( (deg7("4717.11399", 'N') == 472852332) && (deg7("00833.91590", 'E') == 85652650),
+		"Minutes converted to degrees x 1e7");	// 17.11399' = 0.285233166 deg, 33.91590' = 0.565265 deg
+	check( (deg7("4717.11399", 'S') == -472852332) && (deg7("00833.91590", 'W') == -85652650),
+		"South and West negative");
+	check( (deg7("0000.00001", 'N') == 2) && (deg7("0000.00001", 'S') == -2) && (deg7("0000.00002", 'E') == 3)
+		&& (deg7("0000.00004", 'W') == -7), "Rounded to the nearest 1e-7 degree");	// 1.67, 3.33 and 6.67 x 1e-7
+	check( (deg7("18000.00000", 'E') == 1800000000) && (deg7("17959.99999", 'W') == -1799999998),
+		"Longitudes up to 180 degrees");
+	check( (deg7("4717.1139912", 'N') == 472852332) && (deg7("4717.1", 'N') == 472850000),
+		"Minutes of any precision");
+	check( (deg7("", 'N') == 0) && (deg7("17.11399", 'N') == 0) && (deg7("47x7.11399", 'N') == 0),
+		"Malformed coordinates are zero");
+
+	char buff[12];
+	Coordinate c(StaticString("4717.11399"), 'S');
+	check(c.toString(buff) == " 4717.1139", "Written back as dddmm.mmmm");
+}
+
+static void fields(){
+	check( scaled<uint16_t>("1.18", 2u, 118u) && scaled<uint16_t>("0.92", 2u, 92u) && scaled<uint16_t>("1.5", 2u, 150u)
+		&& scaled<uint16_t>("99", 2u, 9900u), "DOPs x 100");
+	check( scaled<int32_t>("499.6", 3u, 499600) && scaled<int32_t>("-12.345", 3u, -12345) && scaled<int32_t>("0", 3u, 0),
+		"Altitudes in mm");
+	check( scaled<int32_t>("0.007", 3u, 7) && scaled<int32_t>("-0.007", 3u, -7) && scaled<int32_t>("+1.25", 3u, 1250),
+		"Speeds in mm/s");
+	check( scaled<uint16_t>("1.189", 2u, 118u) && scaled<int32_t>("0.0049", 3u, 4) && scaled<int32_t>("-0.0049", 3u, -4)
+		&& scaled<int32_t>("77.5200049", 5u, 7752000), "Surplus digits truncated towards zero");
+	check( scaled<int32_t>("2147483", 3u, 2147483000) && rejected<int32_t>("2147484", 3u) && rejected<int32_t>("-2147484", 3u),
+		"Overflow of int32_t rejected");
+	check( scaled<uint16_t>("655.35", 2u, 65535u) && rejected<uint16_t>("655.36", 2u) && rejected<uint16_t>("-1.00", 2u)
+		&& scaled<uint8_t>("2.55", 2u, 255u) && rejected<uint8_t>("2.56", 2u), "Values out of range of the type rejected");
+	check( rejected<int32_t>("", 3u) && rejected<int32_t>(".", 3u) && rejected<int32_t>("1.2.3", 3u)
+		&& rejected<int32_t>("1e3", 3u) && rejected<int32_t>("1", Field::maxDigits + 1u), "Malformed fields rejected");
+}
+
+int main(){
+	coordinates();
+	fields();
+	return result();
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file			: nmea_ids.cpp
+  * @brief			: Test of NMEA Sentence and Talker Identification
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Identifies every standard sentence formatter and talker, and every PUBX message, by their packed characters. Each
+ * formatter and talker must map back to the same characters through toString(), and a sentence must be identified
+ * whichever talker sends it. PUBX,40 and PUBX,03 must be told apart, and formatters, talkers and sentences of any other
+ * length or content must be UNKNOWN.
+ */
+
+#include "Check.hpp"
+#include "M9N_C_API.hpp"
+
+#include <cstring>
+#include <string>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+using PUBX = M9N_Base::NMEA_PUBX;
+
+/**
+ * Exposes the protected lookups.
+ */
+struct Ids : NMEA_Standard{
+	using NMEA_Standard::getMessage;
+	using NMEA_Standard::getTalkerId;
+	using NMEA_Standard::toString;
+};
+
+static bool same(const StaticString & s, const char * c){
+	return (s.size() == strlen(c)) && (memcmp(s.begin(), c, s.size()) == 0);
+}
+
+static PUBX::Message sentence(const std::string & s){
+	return PUBX::getMessage(StaticString(s.c_str()));
+}
+
+typedef NMEA_Standard::Message N;
+typedef PUBX::Message P;
+
+static const struct{ const char * sss; N standard; P pubx; } formatters[] = {
+	{"DTM", N::DTM, P::DTM}, {"GAQ", N::GAQ, P::GAQ}, {"GBQ", N::GBQ, P::GBQ}, {"GBS", N::GBS, P::GBS},
+	{"GGA", N::GGA, P::GGA}, {"GLL", N::GLL, P::GLL}, {"GLQ", N::GLQ, P::GLQ}, {"GNQ", N::GNQ, P::GNQ},
+	{"GNS", N::GNS, P::GNS}, {"GPQ", N::GPQ, P::GPQ}, {"GRS", N::GRS, P::GRS}, {"GSA", N::GSA, P::GSA},
+	{"GST", N::GST, P::GST}, {"GSV", N::GSV, P::GSV}, {"RLM", N::RLM, P::RLM}, {"RMC", N::RMC, P::RMC},
+	{"TXT", N::TXT, P::TXT}, {"VLW", N::VLW, P::VLW}, {"VTG", N::VTG, P::VTG}, {"ZDA", N::ZDA, P::ZDA}
+};
+
+static const char * const talkers[] = { "GP", "GL", "GA", "GB", "GQ", "GN" };
+
+int main(){
+	bool formatter = true, talked = true, bare = true;
+	for(const auto & f : formatters){
+		formatter &= (Ids::getMessage(StaticString(f.sss)) == f.standard) && same(Ids::toString(f.standard), f.sss);
+		for(const char * t : talkers) talked &= (sentence(std::string("$") + t + f.sss + ",") == f.pubx);
+		bare &= (sentence(std::string("$") + f.sss + ",0") == f.pubx);
+	}
+	check(formatter, "Every formatter maps back to its characters");
+	check(talked, "Every formatter is identified whichever the talker");
+	check(bare, "A formatter without a talker is identified");
+
+	bool talker = true;
+	for(const char * t : talkers){
+		const auto id = Ids::getTalkerId(StaticString(t));
+		talker &= (id != NMEA_Standard::TalkerID::UNKNOWN) && same(Ids::toString(id), t);
+	}
+	check(talker, "Every talker maps back to its characters");
+
+	check( (sentence("$PUBX,00,") == P::PUBX_POSITION) && (sentence("$PUBX,03,") == P::PUBX_SVSTATUS)
+		&& (sentence("$PUBX,04,") == P::PUBX_TIME) && (sentence("$PUBX,40,") == P::PUBX_RATE)
+		&& (sentence("$PUBX,41,") == P::PUBX_CONFIG), "Every PUBX message is identified");
+
+	check( (Ids::getMessage(StaticString("GGB")) == NMEA_Standard::Message::UNKNOWN)
+		&& (Ids::getMessage(StaticString("GG")) == NMEA_Standard::Message::UNKNOWN)
+		&& (Ids::getMessage(StaticString("GGAA")) == NMEA_Standard::Message::UNKNOWN), "Unknown formatters");
+	check( (Ids::getTalkerId(StaticString("GX")) == NMEA_Standard::TalkerID::UNKNOWN)
+		&& (Ids::getTalkerId(StaticString("G")) == NMEA_Standard::TalkerID::UNKNOWN)
+		&& (Ids::getTalkerId(StaticString("GPS")) == NMEA_Standard::TalkerID::UNKNOWN), "Unknown talkers");
+	check( (sentence("$GPGGB,") == P::UNKNOWN) && (sentence("$GPGGA") == P::UNKNOWN)
+		&& (sentence("$PUBX,05,") == P::UNKNOWN) && (sentence("$PUBX,") == P::UNKNOWN)
+		&& (sentence("$GPGGAX,") == P::UNKNOWN), "Unknown sentences");
+
+	return result();
+}
+
+/*** END OF FILE ***/
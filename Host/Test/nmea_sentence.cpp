@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file			: nmea_sentence.cpp
+  * @brief			: Test of the Single-Pass NMEA Sentence Split and Verification
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Splits sentences with NMEA_Standard::Sentence. A valid sentence must yield each comma delimited field, empty ones
+ * included, and its checksum. A sentence with a corrupted character or checksum, no "*hh", no "$" or more than
+ * maxFields fields must have no fields at all, and must be rejected by NMEA_Standard::valid() alike.
+ *
+ * A sentence already verified by Framer is split alike, with its checksum read rather than recomputed.
+ */
+
+#include "Capture.hpp"
+#include "Check.hpp"
+#include "M9N_C_API.hpp"
+#include "NMEA_Standard.hpp"
+
+#include <cctype>
+#include <cstring>
+#include <string>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+typedef NMEA_Standard::Sentence Sentence;
+
+static bool same(const StaticString & s, const char * c){
+	return (s.size() == strlen(c)) && (memcmp(s.begin(), c, s.size()) == 0);
+}
+
+/**
+ * @return Whether s is rejected by both the Sentence split and NMEA_Standard::valid().
+ */
+static bool rejected(const std::string & s){
+	const StaticString v(s.c_str());
+	const Sentence f(v);
+	return !f.valid() && (f.size() == 0u) && f[0].empty() && !NMEA_Standard::valid(v);
+}
+
+int main(){
+	const std::string gsa = Capture::sentence("GNGSA,A,3,23,29,07,08,09,18,26,,,,,,1.94,1.18,1.54,1");
+	const StaticString gsaS(gsa.c_str());
+	const Sentence f(gsaS);
+
+	check(f.valid() && NMEA_Standard::valid(gsaS) && (f.size() == 19u), "A valid sentence is split into every field");
+	check(same(f[0], "GNGSA") && same(f[1], "A") && same(f[3], "23") && same(f[9], "26") && same(f[15], "1.94")
+		&& same(f[18], "1"), "Fields hold the characters between the delimiters");
+	check(f[10].empty() && f[14].empty(), "Empty fields are kept in place");
+	check(f[19].empty() && f[Sentence::maxFields].empty(), "Fields past the last are empty");
+	check(f.checksum() == std::stoul(gsa.substr(gsa.size() - 4u, 2u), nullptr, 16), "The checksum is that of the sentence");
+
+	std::string lower = Capture::sentence("GNGLL,4717.11364,N,00833.91565,E,092300.00,A,A");	// "*7D"
+	lower[lower.size() - 3u] = std::tolower(lower[lower.size() - 3u]);
+	check(Sentence(StaticString(lower.c_str())).valid(), "Lowercase checksum digits are accepted");
+
+	std::string corrupt = gsa;
+	corrupt[8] = '4';
+	std::string badSum = gsa;
+	badSum[badSum.size() - 3u] ^= 1;
+	check(rejected(corrupt) && rejected(badSum), "A corrupted character or checksum is rejected");
+	check(rejected("$GNGSA,A,3\r\n") && rejected(gsa.substr(0u, gsa.size() - 4u)) && rejected(gsa.substr(1u)),
+		"A sentence without \"*hh\" or \"$\" is rejected");
+
+	const std::string fields31 = Capture::sentence("GNTXT" + std::string(Sentence::maxFields - 1u, ','));
+	const std::string fields33 = Capture::sentence("GNTXT" + std::string(Sentence::maxFields, ','));
+	check( (Sentence(StaticString(fields31.c_str())).size() == Sentence::maxFields) && rejected(fields33),
+		"Sentences of up to maxFields fields are split");
+
+	const Sentence framed(gsaS, true);
+	bool split = framed.valid() && (framed.size() == f.size()) && (framed.checksum() == f.checksum());
+	for(uint8_t i = 0u; i < f.size(); i++) split &= (framed[i].begin() == f[i].begin()) && (framed[i].size() == f[i].size());
+	check(split, "A verified sentence is split alike");
+	check(Sentence(StaticString(corrupt.c_str()), true).valid() && !Sentence(StaticString("$GNGSA,A,3*0G\r\n"), true).valid(),
+		"A verified sentence's checksum is read, not recomputed");
+
+	const std::string gll = Capture::sentence("GNGLL,4717.11364,N,00833.91565,E,092300.00,A,A");
+	const NMEA_Standard::GLL a(StaticString(gll.c_str())), b(Sentence(StaticString(gll.c_str())));
+	check( (a.lat.deg7 == 472852273) && (a.lon.deg7 == 85652608) && (a.lat.deg7 == b.lat.deg7) && (a.lon.deg7 == b.lon.deg7)
+		&& (a.time.hh == 9u) && (a.time.mm == 23u) && (a.status == 'A'), "A message decodes from its Sentence");
+
+	return result();
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,135 @@
+/**
+  ******************************************************************************
+  * @file			: pubx_fields.cpp
+  * @brief			: Test of the PUBX,00, PUBX,03 and PUBX,04 Parsers
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Parses PUBX,00, PUBX,03 and PUBX,04 sentences as the receiver sends them, and checks every field against the index
+ * of the interface description. A PUBX,03 longer than a Sentence must be read whole, truncated at capacity, and left
+ * empty when its checksum is wrong. getMessage() must tell each PUBX message apart. Then replays PUBX,04 and PUBX,00
+ * through the driver, which must publish the fix to the C API.
+ */
+
+#include "Capture.hpp"
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+
+#include <cstdio>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+using PUBX = M9N_Base::NMEA_PUBX;
+
+static const char * const position = "PUBX,00,092300.00,4717.113210,N,00833.915187,E,546.589,G3,2.1,2.0,0.007,77.52,0.007,,0.92,1.19,0.77,9,0,0";
+static const char * const timeOfDay = "PUBX,04,092300.00,091222,465780.00,2239,18,-12345,25.310,21";
+static const char * const svStatus = "PUBX,03,12,007,U,138,17,42,064,008,U,210,56,46,064,009,U,048,23,44,064,016,-,287,66,,000,"
+	"018,U,066,21,43,064,023,U,298,44,47,064,026,U,161,31,44,064,027,-,043,17,,000,029,U,112,48,47,064,065,e,100,10,20,003,"
+	"066,U,200,20,22,012,211,U,045,60,38,040";
+
+static void messages(){
+	const auto id = [](const char * body){
+		const std::string s = Capture::sentence(body);
+		return PUBX::getMessage(StaticString(s.c_str()));
+	};
+	check( (id(position) == PUBX::Message::PUBX_POSITION) && (id(svStatus) == PUBX::Message::PUBX_SVSTATUS)
+		&& (id(timeOfDay) == PUBX::Message::PUBX_TIME) && (id("PUBX,40,GGA,0,1,0,0,0,0") == PUBX::Message::PUBX_RATE)
+		&& (id("PUBX,41,1,0007,0003,38400,0") == PUBX::Message::PUBX_CONFIG) && (id("PUBX,05,") == PUBX::Message::UNKNOWN),
+		"getMessage() tells each PUBX message apart");
+}
+
+static void positionFields(){
+	const std::string s = Capture::sentence(position);
+	const PUBX::Position p{StaticString(s.c_str())};
+	check( (p.time.hh == 9u) && (p.time.mm == 23u) && (p.time.ss == 0u) && (p.lat == 472852202) && (p.lon == 85652531),
+		"PUBX,00 time and position");
+	check( (p.altRef == 546589) && (p.navStat == PUBX::Position::NavStatus::G3) && (p.hAcc == 2100) && (p.vAcc == 2000),
+		"PUBX,00 altitude, status and accuracy");
+	check( (p.sog == 7) && (p.cog == 7752000) && (p.vVel == 7) && (p.diffAge == 0.0f), "PUBX,00 speed, course and vertical velocity");
+	check( (p.hdop == 92u) && (p.vdop == 119u) && (p.tdop == 77u) && (p.numSvs == 9u) && (p.dr == 0u), "PUBX,00 DOPs and satellites");
+}
+
+static void timeFields(){
+	const std::string s = Capture::sentence(timeOfDay);
+	const PUBX::Time t{StaticString(s.c_str())};
+	check( (t.time.hh == 9u) && (t.time.mm == 23u) && (t.time.day == 9u) && (t.time.month == 12u) && (t.time.year == 2022u),
+		"PUBX,04 time and date");
+	check( (t.utcTow == 465780000u) && (t.utcWk == 2239u) && (t.leapSec == 18u) && !t.leapDefault, "PUBX,04 time of week and leap seconds");
+	check( (t.clkBias == -12345) && (t.clkDrift == 25310) && (t.tpGran == 21u), "PUBX,04 clock bias, drift and granularity");
+
+	const std::string d = Capture::sentence("PUBX,04,092300.00,091222,465780.00,2239,18D,-12345,25.310,21");
+	const PUBX::Time u{StaticString(d.c_str())};
+	check( (u.leapSec == 18u) && u.leapDefault, "PUBX,04 default leap seconds");
+}
+
+static void svStatusFields(){
+	const std::string s = Capture::sentence(svStatus);
+	const PUBX::SvStatus v{StaticString(s.c_str())};
+	check( (v.n == 12u) && (v.count == 12u), "PUBX,03 read whole");
+	check( (v.sv[0].svid == 7u) && (v.sv[0].s == 'U') && (v.sv[0].az == 138u) && (v.sv[0].el == 17u) && (v.sv[0].cno == 42u)
+		&& (v.sv[0].lck == 64u), "PUBX,03 fields of the first satellite");
+	check( (v.sv[3].svid == 16u) && (v.sv[3].s == '-') && (v.sv[3].cno == 0u) && (v.sv[9].s == 'e') && (v.sv[9].lck == 3u),
+		"PUBX,03 satellites not used");
+	check( (v.sv[11].svid == 211u) && (v.sv[11].az == 45u) && (v.sv[11].el == 60u) && (v.sv[11].cno == 38u) && (v.sv[11].lck == 40u),
+		"PUBX,03 fields of the last satellite");
+
+	std::string bad = s;
+	bad[bad.size() - 3] ^= 0x01;	// Last checksum digit.
+	check(PUBX::SvStatus{StaticString(bad.c_str())}.count == 0u, "PUBX,03 with a bad checksum is empty");
+
+	std::string many = "PUBX,03,30";
+	for(unsigned i = 1u; i <= 30u; i++){
+		char sat[24];
+		snprintf(sat, sizeof(sat), ",%03u,U,100,10,30,064", i);
+		many += sat;
+	}
+	const std::string m = Capture::sentence(many);
+	const PUBX::SvStatus t{StaticString(m.c_str())};
+	check( (t.n == 30u) && (t.count == PUBX::SvStatus::capacity) && (t.sv[PUBX::SvStatus::capacity - 1u].svid == PUBX::SvStatus::capacity),
+		"PUBX,03 truncated at capacity");
+}
+
+static void driver(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 38400u;
+	HAL_UART_Init(&huart4);
+	GPS_Init();	// No receiver: the boot configuration times out.
+
+	const std::string s = Capture::sentence(timeOfDay) + Capture::sentence(position);
+	HAL_Sim::feed(&huart4, reinterpret_cast<const uint8_t *>(s.data()), s.size());
+	for(int k = 0; k < 50; k++){
+		HAL_Delay(5);
+		GPS_Update();
+	}
+	const auto & p = gpsDataLive.coordinates;
+	check( (p.lat == 472852202) && (p.longi == 85652531) && (p.alt == 546589) && (p.speed == 1) && (p.course == 7752000),
+		"PUBX,00 position published to the C API");
+	check( (gpsDataLive.diag.HDOP == 92u) && (gpsDataLive.diag.VDOP == 119u) && (gpsDataLive.diag.num_sats == 9u)
+		&& (gpsDataLive.diag.fix_type == 3u) && (gpsDataLive.diag.fix_quality == 1u), "PUBX,00 diagnostics published to the C API");
+	check(p.time == 1670577780u, "Time published from the PUBX,04 date: 2022-12-09 09:23:00 UTC");
+}
+
+int main(){
+	messages();
+	positionFields();
+	timeFields();
+	svStatusFields();
+	driver();
+	return result();
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,132 @@
+/**
+  ******************************************************************************
+  * @file			: ring_lap.cpp
+  * @brief			: Test of Overrun Detection When an External Producer Laps the Rx Ring
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Stands in for the DMA controller in zero-copy mode, writing a capture into storage() and committing at every half
+ * ring, while the consumer frames the ring as M9N::scanMessages does but falls behind at chosen points. Each lap must
+ * be reported once by resync() and counted as dropped, and every frame must match the capture, including those
+ * framed after the consumer has resynchronised.
+ */
+
+#include "Capture.hpp"
+#include "Check.hpp"
+#include "Framer.hpp"
+#include "M9N_C_API.hpp"
+#include "RingBuffer.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+static const size_t ringSize = 8u * 254u;	// As UART::Rx in zero-copy mode.
+static const uint16_t half = ringSize / 2u;
+
+static RingBuffer<ringSize> ring;
+static Capture::Stream s;
+static size_t produced = 0u;	// Capture characters written.
+
+/**
+ * @brief Writes n characters of the capture at the DMA position and commits them, as the half and complete events do.
+ *
+ * @return The characters counted as dropped by the commit.
+ */
+static uint16_t dma(uint16_t n){
+	uint16_t lost = 0u;
+	while(n > 0u){
+		const uint16_t h = ring.writeIndex();
+		uint16_t k = static_cast<uint16_t>(half - h % half);	// Up to the next event.
+		if(k > n) k = n;
+		memcpy(ring.storage() + h, s.data() + produced, k);
+		produced += k;
+		n -= k;
+		lost += ring.commit(h + k);
+	}
+	return lost;
+}
+
+/**
+ * @brief Frames all unread data.
+ *
+ * @return The number of frames, or -1 if a frame does not occur in the capture or the view was lapped.
+ */
+static long scan(Framer & framer){
+	const SegmentedView v = ring.view();
+	if(ring.resync()){
+		framer.reset();
+		return -1;
+	}
+	long frames = 0;
+	Framer::Frame f;
+	while(framer.next(v, f)){
+		std::string frame(f.size, '\0');
+		for(uint16_t k = 0u; k < f.size; k++) frame[k] = static_cast<char>(v[f.begin + k]);
+		const std::string all(s.begin(), s.begin() + produced);
+		if(all.find(frame) == std::string::npos) return -1;
+		frames++;
+	}
+	ring.consume(framer.release());
+	return frames;
+}
+
+int main(){
+	s = Capture::nmea(200u);
+	Framer framer;
+
+	// Keeping up: consumed after every event.
+	long frames = 0;
+	for(int i = 0; i < 20; i++){
+		dma(half);
+		frames += scan(framer);
+	}
+	check( (frames > 0) && (ring.overruns() == 0u), "No lap while keeping up");
+
+	// Falling behind by less than the ring.
+	dma(ring.free());
+	check(ring.overruns() == 0u, "Filling the ring is not a lap");
+	check(scan(framer) > 0, "A full ring is framed");
+
+	// Falling behind by more than the ring. The lap is in the middle of an event.
+	const uint16_t unread = ring.available();
+	const uint16_t free = ring.free();
+	const uint16_t lost = dma(free + 100u);
+	check(lost == unread + free + 100u, "A lap counts all unread and written characters");
+	check(ring.overruns() == lost, "overruns() counts the lap");
+
+	// Further events before the consumer notices are lost too.
+	check(dma(300u) == 300u, "Commits while lapped are lost");
+
+	// The consumer notices once, discards everything, and resumes.
+	check(scan(framer) < 0, "resync() reports the lap");
+	check( (ring.available() == 0u) && !ring.resync(), "resync() discards all unread data, once");
+	dma(half);
+	check(scan(framer) > 0, "Framing resumes after a lap");
+
+	// An exact lap leaves the indices as if nothing had been written.
+	scan(framer);
+	const uint16_t before = ring.overruns();
+	dma(ring.free() + 1u);
+	check( (ring.available() == 0u) && (ring.overruns() > before) && ring.resync(), "An exact lap is detected");
+
+	check(framer.statistics().errors == 0u, "No frame errors");
+	return result();
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file			: ring_stress.cpp
+  * @brief			: Stress Test of the Rx RingBuffer Across Two Threads
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * A producer thread stands in for the DMA controller and Rx event interrupt, delivering a capture in bursts of up to
+ * one DMA buffer, while a consumer thread frames the ring's contents in place as M9N::scanMessages does. Every frame
+ * must match the capture at its position, and consecutive frames must cover the capture without gap or overlap.
+ *
+ * The producer runs twice: copying each burst in with write(), as the offload ring is filled, and writing each burst
+ * straight into storage() before commit(), as in zero-copy mode. It never overruns the consumer, so no byte may be
+ * lost.
+ */
+
+#include "Capture.hpp"
+#include "Check.hpp"
+#include "Framer.hpp"
+#include "M9N_C_API.hpp"
+#include "RingBuffer.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+static const size_t ringSize = 8u * 254u;	// As UART::Rx.
+static const uint16_t burstMax = 254u;		// One DMA buffer.
+
+enum class Mode{ WRITE, COMMIT };
+
+static void produce(RingBuffer<ringSize> & ring, const Capture::Stream & s, Mode mode){
+	uint32_t x = 0x12345678u;	// xorshift32, for burst sizes.
+	size_t i = 0u;
+	while(i < s.size()){
+		x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+		uint16_t n = 1u + x % burstMax;
+		if(n > s.size() - i) n = static_cast<uint16_t>(s.size() - i);
+
+		while(ring.free() < n) std::this_thread::yield();	// A DMA controller cannot wait. Here it must not overrun.
+		if(mode == Mode::WRITE){
+			ring.write(s.data() + i, n);
+		}
+		else{
+			const uint16_t h = ring.writeIndex();
+			const uint16_t first = (n < ringSize - h) ? n : static_cast<uint16_t>(ringSize - h);
+			memcpy(ring.storage() + h, s.data() + i, first);
+			memcpy(ring.storage(), s.data() + i + first, n - first);
+			ring.commit(h + n);
+		}
+		i += n;
+	}
+}
+
+/**
+ * @return The number of frames matching the capture, or -1 upon any mismatch. The ring is drained either way.
+ */
+static long consume(RingBuffer<ringSize> & ring, const Capture::Stream & s){
+	Framer framer;
+	size_t base = 0u;		// Capture index of the ring's read index.
+	size_t expected = 0u;	// Capture index at which the next frame must begin.
+	long frames = 0;
+	bool mismatch = false;
+
+	while(base < s.size()){
+		const SegmentedView v = ring.view();
+		if(v.empty()){
+			std::this_thread::yield();
+			continue;
+		}
+		if(mismatch){	// Only release the producer.
+			ring.consume(v.size());
+			base += v.size();
+			continue;
+		}
+
+		Framer::Frame f;
+		while(!mismatch && framer.next(v, f)){
+			mismatch = (base + f.begin != expected);
+			for(uint16_t k = 0u; !mismatch && (k < f.size); k++) mismatch = (v[f.begin + k] != s[expected + k]);
+			expected += f.size;
+			frames++;
+		}
+		const uint16_t n = framer.release();
+		ring.consume(n);
+		base += n;
+	}
+	return (mismatch || (framer.statistics().errors != 0u)) ? -1 : frames;
+}
+
+int main(){
+	const Capture::Stream s = Capture::nmea(500u);	// 255 kB, 125 times the ring.
+	const long sentences = 500 * 9;
+
+	static RingBuffer<ringSize> rings[2];
+	for(Mode mode : {Mode::WRITE, Mode::COMMIT}){
+		RingBuffer<ringSize> & ring = rings[static_cast<int>(mode)];
+
+		long frames = 0;
+		std::thread consumer([&]{ frames = consume(ring, s); });
+		produce(ring, s, mode);
+		consumer.join();
+
+		printf("%s: %zu bytes, %ld of %ld sentences, %u dropped\n", (mode == Mode::WRITE) ? "write " : "commit",
+			s.size(), frames, sentences, static_cast<unsigned>(ring.overruns()));
+		check( (frames == sentences) && (ring.overruns() == 0u) && (ring.available() == 0u),
+			(mode == Mode::WRITE) ? "Every sentence framed, copied in with write()" : "Every sentence framed, committed in place");
+	}
+	return result();
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,129 @@
+/**
+  ******************************************************************************
+  * @file			: satellite_table.cpp
+  * @brief			: Test of GSV Group Assembly into the Satellite Table
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Passes sequences of GSV sentences to a SatelliteTable: groups of several talkers and signals, a group restarted by a
+ * repeated first sentence, a group broken by a sentence out of sequence, an empty group and a sentence without a
+ * signal ID. The current table must only ever hold complete groups, each replacing the rows of its own talker and
+ * signal. A PUBX,03 must replace the whole table. Then replays the standard capture through the driver, which must
+ * publish the satellites tracked as num_sats.
+ */
+
+#include "Capture.hpp"
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+#include "SatelliteTable.hpp"
+
+#include <cstdio>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+using TalkerID = NMEA_Standard::TalkerID;
+
+static SatelliteTable table;
+
+/**
+ * @return true if the sentence completed a group.
+ */
+static bool gsv(const char * body){
+	const std::string s = Capture::sentence(body);
+	return table.receive(NMEA_Standard::GSV{StaticString(s.c_str())});
+}
+
+static bool summary(uint8_t inView, uint8_t tracked, uint8_t maxCno, uint8_t meanCno){
+	const auto s = table.summary();
+	return (s.inView == inView) && (s.tracked == tracked) && (s.maxCno == maxCno) && (s.meanCno == meanCno);
+}
+
+/**
+ * @return The row of a talker's satellite, or -1 if none.
+ */
+static int row(TalkerID talker, uint8_t svid){
+	const auto & t = table.current();
+	for(uint8_t i = 0u; i < t.count; i++) if( (t.talker[i] == talker) && (t.svid[i] == svid) ) return i;
+	return -1;
+}
+
+static void assembly(){
+	// A group is published only once complete.
+	check(!gsv("GPGSV,2,1,05,01,10,100,30,02,20,200,40,03,30,300,,04,40,040,35,1") && (table.current().count == 0u),
+		"A partial group is not published");
+	check(gsv("GPGSV,2,2,05,05,50,050,45,1") && summary(5u, 4u, 45u, 37u), "A complete group is published");
+	const auto & t = table.current();
+	const int r = row(TalkerID::GP, 4u);
+	check( (r >= 0) && (t.elevation[r] == 40u) && (t.azimuth[r] == 40u) && (t.cno[r] == 35u) && (t.signalId[r] == 1u), "Rows hold every field");
+
+	// Another talker's group is added alongside.
+	check(gsv("GLGSV,1,1,02,65,10,100,20,66,20,200,22,1") && summary(7u, 6u, 45u, 32u), "Another talker's group is added");
+
+	// A repeated first sentence restarts the group, and the table is unchanged until it completes.
+	gsv("GPGSV,2,1,05,01,10,100,30,02,20,200,40,03,30,300,,04,40,040,35,1");
+	check(!gsv("GPGSV,2,1,05,01,10,100,31,02,20,200,41,03,30,300,,04,40,040,36,1") && summary(7u, 6u, 45u, 32u),
+		"The table is unchanged while a group is assembled");
+	check(gsv("GPGSV,2,2,05,05,50,050,45,1") && summary(7u, 6u, 45u, 32u) && (table.current().cno[row(TalkerID::GP, 1u)] == 31u),
+		"A repeated first sentence restarts the group");
+
+	// A sentence out of sequence discards the group.
+	gsv("GPGSV,2,1,05,01,10,100,30,02,20,200,40,03,30,300,,04,40,040,35,1");
+	check(!gsv("GAGSV,2,2,01,05,50,050,45,7") && !gsv("GPGSV,2,2,05,05,50,050,45,1") && summary(7u, 6u, 45u, 32u),
+		"A group broken by another group's sentence is discarded");
+	check(gsv("GPGSV,1,1,01,05,50,050,45,1") && summary(3u, 3u, 45u, 29u) && (row(TalkerID::GP, 1u) < 0),
+		"A group replaces its talker's rows");
+
+	// An empty group removes its talker's rows.
+	check(gsv("GLGSV,1,1,00,1") && summary(1u, 1u, 45u, 45u) && (row(TalkerID::GL, 65u) < 0), "An empty group removes its rows");
+
+	// NMEA 4.0: no signal ID. A group of its own.
+	check(gsv("GPGSV,1,1,01,07,17,138,42") && (table.current().count == 2u) && (table.current().signalId[row(TalkerID::GP, 7u)] == 0u),
+		"A sentence without a signal ID is a group of its own");
+
+	// PUBX,03 replaces the whole table.
+	const std::string s = Capture::sentence("PUBX,03,03,23,U,298,44,47,064,08,e,210,56,46,064,09,-,048,23,,000");
+	check(table.receive(M9N_Base::NMEA_PUBX::SvStatus{StaticString(s.c_str())}) && summary(3u, 2u, 47u, 46u)
+		&& (row(TalkerID::GN, 23u) >= 0) && (row(TalkerID::GP, 5u) < 0), "PUBX,03 replaces the whole table");
+
+	table.clear();
+	check(table.current().count == 0u, "clear() empties the table");
+}
+
+static void driver(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 38400u;
+	HAL_UART_Init(&huart4);
+	GPS_Init();	// No receiver: the boot configuration times out.
+
+	const Capture::Stream c = Capture::nmea(3u);
+	HAL_Sim::feed(&huart4, c.data(), c.size());
+	for(int k = 0; k < 200; k++){
+		HAL_Delay(5);
+		GPS_Update();
+	}
+	const auto s = m9n.satellites().summary();
+	printf("Capture: %u in view, %u tracked\n", static_cast<unsigned>(s.inView), static_cast<unsigned>(s.tracked));
+	check( (s.inView == 9u) && (s.tracked == 7u) && (gpsDataLive.diag.num_sats == 7u), "Capture's satellites tracked published as num_sats");
+}
+
+int main(){
+	assembly();
+	driver();
+	return result();
+}
+
+/*** END OF FILE ***/
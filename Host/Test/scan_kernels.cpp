@@ -0,0 +1,109 @@
+/**
+  ******************************************************************************
+  * @file			: scan_kernels.cpp
+  * @brief			: Test of the Block Scanning Kernels Against the Scalar Kernel
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Runs every Scan.hpp kernel the host supports (SWAR and SSE2, and AVX2 with `make check ARCH=-mavx2`) on random
+ * blocks, and compares find(), printable(), split() and checksum() against the scalar kernel. Blocks are of every
+ * length up to several block widths, and mostly drawn from the characters the kernels look for, including control
+ * and non-ASCII characters. Each block is copied into a buffer of exactly its length, so that a load outside the
+ * range is caught by `make SANITIZE=1 check`.
+ */
+
+#include "Check.hpp"
+#include "M9N_C_API.hpp"
+#include "Scan.hpp"
+
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+typedef BasicScan<ScalarKernel> Reference;
+
+struct Split{
+	std::vector<size_t> delims;
+	uint8_t chk;
+	size_t end;
+
+	bool operator ==(const Split & o) const { return (delims == o.delims) && (chk == o.chk) && (end == o.end); }
+};
+
+template<typename S>
+static Split split(const uint8_t * p, size_t n, uint8_t delim, uint8_t end){
+	Split r;
+	r.end = S::split(p, n, delim, end, r.chk, [&](size_t i){ r.delims.push_back(i); });
+	return r;
+}
+
+/**
+ * @return Whether kernel S agrees with the scalar kernel on every scan of p.
+ */
+template<typename S>
+static bool agrees(const uint8_t * p, size_t n){
+	static const uint8_t pairs[][2] = { {',', '*'}, {'$', 0xB5u}, {'*', '$'}, {0x00u, 0xFFu} };
+	bool ok = S::checksum(p, n) == Reference::checksum(p, n);
+	for(const auto & ab : pairs){
+		const uint8_t a = ab[0], b = ab[1];
+		uint8_t chkS = 0x5Au, chkR = 0x5Au;	// printable() XORs into chk.
+		ok &= S::find(p, n, a, b) == Reference::find(p, n, a, b);
+		ok &= (S::printable(p, n, a, b, chkS) == Reference::printable(p, n, a, b, chkR)) && (chkS == chkR);
+		ok &= split<S>(p, n, a, b) == split<Reference>(p, n, a, b);
+	}
+	return ok;
+}
+
+int main(){
+	static const uint8_t alphabet[] = { ',', '*', '$', 0xB5u, 0x00u, 0xFFu, '\r', '\n', 0x1Fu, 0x20u, 0x7Eu, 0x7Fu, 0x80u };
+	uint32_t x = 0x2545F491u;	// xorshift32
+	auto next = [&x]{ x ^= x << 13; x ^= x >> 17; x ^= x << 5; return x; };
+
+	const size_t maxLength = 4u * 32u + 7u;
+	bool swar = true, sse2 = true, avx2 = true;
+	for(unsigned round = 0u; round < 200u; round++){
+		for(size_t n = 0u; n <= maxLength; n++){
+			std::vector<uint8_t> block(n);
+			const uint32_t density = 1u + next() % 16u;	// 1 in density characters from the alphabet.
+			for(auto & c : block){
+				const uint32_t r = next();
+				c = ((r >> 8) % density == 0u) ? alphabet[r % sizeof(alphabet)] : static_cast<uint8_t>(r >> 24);
+			}
+			const uint8_t * p = block.data();
+		#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+			swar &= agrees<BasicScan<SwarKernel>>(p, n);
+		#endif
+		#if defined(__SSE2__)
+			sse2 &= agrees<BasicScan<Sse2Kernel>>(p, n);
+		#endif
+		#if defined(__AVX2__)
+			avx2 &= agrees<BasicScan<Avx2Kernel>>(p, n);
+		#endif
+		}
+	}
+
+	check(swar, "SWAR kernel agrees with scalar");
+#if defined(__SSE2__)
+	check(sse2, "SSE2 kernel agrees with scalar");
+#endif
+#if defined(__AVX2__)
+	check(avx2, "AVX2 kernel agrees with scalar");
+#endif
+	(void)sse2; (void)avx2;
+	return result();
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,111 @@
+/**
+  ******************************************************************************
+  * @file			: tx_lanes.cpp
+  * @brief			: Test of the COMMAND and BULK Tx Lanes
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Posts a 100 kB upload on the BULK lane, then a CFG-VALSET command every 150 ms while it is transmitted at 115200 Bd.
+ * The upload contains no 0xB5, so that the receiver can tell each command apart. Every command must arrive whole,
+ * between slices of the upload, in order and within one bulk slice of being posted. The upload must arrive intact
+ * and in order, and the lane statistics must account for every descriptor and bound the commands' queueing delay.
+ */
+
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+using Token = UART::Tx::Token;
+using Lane = UART::Tx::Lane;
+
+static uint8_t blob[100000];	// The upload. Never 0xB5, which begins every command.
+
+static std::vector<uint8_t> received;
+static int uploadsDone = 0;
+
+static void receiver(UART_HandleTypeDef *, const uint8_t * d, uint16_t n, void *){
+	received.insert(received.end(), d, d + n);
+}
+
+int main(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 115200u;
+	HAL_UART_Init(&huart4);
+	HAL_Sim::setTxSink(&huart4, receiver, nullptr);
+	for(size_t i = 0u; i < sizeof(blob); i++) blob[i] = static_cast<uint8_t>(i & 0x7Fu);
+
+	const auto uploaded = [](Token, void *){ uploadsDone++; };
+	const Token first = m9n.post(blob, blob + 60000, uploaded);
+	const Token second = m9n.post(blob + 60000, blob + sizeof(blob), uploaded);
+	check( (first != UART::Tx::wouldBlock) && (second != UART::Tx::wouldBlock) && !m9n.sent(first), "Upload queued on the BULK lane");
+
+	std::vector<std::vector<uint8_t>> commands;
+	uint32_t worst = 0u;
+	for(int k = 0; k < 40; k++){
+		HAL_Sim::advance(150);
+		const UBX::CFG::VAL::SET set{ {CFG_MSGOUT_NMEA_ID_GGA_UART1, static_cast<UBX::U1>(k)} };
+		const uint32_t t0 = HAL_GetTick();
+		const Token t = m9n.post(set);
+		if(t == UART::Tx::wouldBlock) continue;
+		commands.emplace_back(set.frameSize());
+		set.serialize(commands.back().data());
+		while(!m9n.sent(t)) HAL_Sim::advance(1);
+		if(HAL_GetTick() - t0 > worst) worst = HAL_GetTick() - t0;
+	}
+	const bool overlapped = !m9n.sent(second);
+	while(!m9n.sent(second)) HAL_Sim::advance(10);
+
+	// Separate the commands from the upload.
+	std::vector<uint8_t> upload;
+	size_t next = 0u;
+	bool whole = true;
+	for(size_t i = 0u; i < received.size(); ){
+		if(received[i] != 0xB5u){
+			upload.push_back(received[i++]);
+			continue;
+		}
+		const auto & c = commands[next < commands.size() ? next : 0u];
+		whole &= (next < commands.size()) && (received.size() - i >= c.size()) && std::equal(c.begin(), c.end(), received.begin() + i);
+		i += c.size();
+		next++;
+	}
+
+	printf("%zu commands, worst %u ms from post to sent\n", commands.size(), static_cast<unsigned>(worst));
+	check( (commands.size() == 40u) && overlapped, "Every command posted while the upload was transmitted");
+	check(whole && (next == commands.size()), "Every command received whole and in order");
+	check( (upload.size() == sizeof(blob)) && std::equal(upload.begin(), upload.end(), blob), "Upload received intact and in order");
+	check( (uploadsDone == 2) && m9n.sent(first), "Upload notified and reported sent");
+	check(worst <= 26u, "Each command sent within one bulk slice and its own length (22 + 2 ms)");
+
+	for(auto l : {Lane::COMMAND, Lane::BULK}){
+		const auto & s = m9n.txStatistics(l);
+		printf("%s lane: %u descriptors, %.1f ms mean and %u ms longest delay\n", (l == Lane::COMMAND) ? "COMMAND" : "BULK",
+			static_cast<unsigned>(s.messages), s.messages ? static_cast<double>(s.totalDelay) / s.messages : 0.0, static_cast<unsigned>(s.maxDelay));
+	}
+	const auto & command = m9n.txStatistics(Lane::COMMAND), & bulk = m9n.txStatistics(Lane::BULK);
+	check( (command.messages == 40u) && (bulk.messages == 2u), "Statistics count every descriptor of each lane");
+	check( (command.maxDelay <= 23u) && (bulk.maxDelay >= 5000u), "Statistics bound the commands' delay, not the upload's");
+
+	return result();
+}
+
+/*** END OF FILE ***/
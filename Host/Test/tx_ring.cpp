@@ -0,0 +1,81 @@
+/**
+  ******************************************************************************
+  * @file			: tx_ring.cpp
+  * @brief			: Test of the UART Transmission Ring
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Allocates, fills and transmits thousands of messages of random size through a UART::Tx on its own UART, sometimes
+ * transmitting only part of an allocation, with the simulated clock advancing at random between them. Every character
+ * transmitted must reach the line once and in order, across every loop of the ring, and no allocation that fits the
+ * ring may fail.
+ */
+
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+static UART_HandleTypeDef huart1;
+static std::vector<uint8_t> line;	// Everything transmitted.
+
+static void sink(UART_HandleTypeDef *, const uint8_t * d, uint16_t n, void *){
+	line.insert(line.end(), d, d + n);
+}
+
+int main(){
+	huart1.Instance = USART1;
+	huart1.Init.BaudRate = 115200u;
+	HAL_UART_Init(&huart1);
+	HAL_Sim::setTxSink(&huart1, sink, nullptr);
+
+	UART::Tx tx(&huart1);	// Completions are not routed to it, so the ring is served by nextTransmission() below.
+
+	std::vector<uint8_t> sent;
+	int refused = 0;
+	uint8_t c = 0u;
+	srand(7);
+	for(int i = 0; i < 20000; i++){
+		const uint16_t size = 1u + rand() % ((rand() % 8 == 0) ? 500 : 40);
+		uint8_t * p = tx.alloc(size);
+		if(p == nullptr){
+			refused++;
+			continue;
+		}
+		const uint16_t n = (rand() % 4 == 0) ? 1u + rand() % size : size;	// Sometimes only part is used.
+		for(uint16_t k = 0; k < n; k++) sent.push_back(p[k] = c++);
+		tx.transmit(n);
+
+		HAL_Sim::advance(rand() % 3);
+		tx.nextTransmission();
+	}
+	for(int t = 0; (t < 1000) && (line.size() < sent.size()); t++){
+		HAL_Sim::advance(1);
+		tx.nextTransmission();
+	}
+
+	check(refused == 0, "No allocation which fits is refused");
+	check(line == sent, "Every character is transmitted once and in order");
+	check( (tx.alloc(0u) == nullptr) && (tx.alloc(512u) == nullptr), "Empty and oversized allocations are refused");
+
+	return result();
+}
+
+/*** END OF FILE ***/
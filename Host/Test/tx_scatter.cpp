@@ -0,0 +1,149 @@
+/**
+  ******************************************************************************
+  * @file			: tx_scatter.cpp
+  * @brief			: Test of Scatter-Gather Tx Descriptors Sending Immutable Data in Place
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Posts a random mix of frames copied into the Tx buffer, segments of a large constant array standing in for flash,
+ * a frame encoded at compile time, and uploads larger than one DMA transfer, all on the COMMAND lane. The receiver
+ * must be sent every segment once and in order, with each notification after its segment. Data held in place must
+ * not take space in the Tx buffer, and segments which continue on in memory must be joined into one transfer.
+ */
+
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+using KeyValuePair = UBX::CFG::VAL::KeyValuePair;
+using Token = UART::Tx::Token;
+using Lane = UART::Tx::Lane;
+
+static uint8_t flash[200000];	// Immutable once filled.
+
+static constexpr KeyValuePair profile[] = { {CFG_RATE_MEAS, static_cast<UBX::U2>(100u)}, {CFG_RATE_NAV, static_cast<UBX::U2>(1u)} };
+static constexpr auto encoded = UBX::CFG::VAL::SET::encode<profile>();
+
+static std::vector<uint8_t> received;
+static int transfers = 0;
+static std::vector<Token> notified;
+static int early = 0;
+
+static void receiver(UART_HandleTypeDef *, const uint8_t * d, uint16_t n, void *){
+	received.insert(received.end(), d, d + n);
+	transfers++;
+}
+
+static void done(Token t, void *){
+	notified.push_back(t);
+	if(received.size() < t) early++;
+}
+
+int main(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 921600u;
+	HAL_UART_Init(&huart4);
+	HAL_Sim::setTxSink(&huart4, receiver, nullptr);
+
+	srand(3);
+	for(auto & c : flash) c = static_cast<uint8_t>(rand());
+	std::vector<KeyValuePair> kv(UBX::CFG::VAL::SET::maxKeys);
+	for(size_t i = 0u; i < kv.size(); i++) kv[i] = {CFG_MSGOUT_NMEA_ID_GGA_UART1, static_cast<UBX::U1>(i)};
+
+	std::vector<uint8_t> posted;
+	std::vector<Token> expected;
+	int wouldBlock = 0, waited = 0, misnumbered = 0, inPlace = 0, large = 0;
+	for(int i = 0; i < 30000; i++){
+		const int kind = rand() % 10;
+		const bool notify = rand() % 2;
+		const uint8_t * first, * last;
+		Token t;
+		std::vector<uint8_t> copied;
+
+		const uint32_t t0 = HAL_GetTick();
+		if(kind < 4){	// Copied into the Tx buffer.
+			const UBX::CFG::VAL::SET::TRANSACTION frame{UBX::CFG::VAL::Action::TRANSACTIONLESS, kv.data(), kv.data() + 1u + rand() % kv.size()};
+			copied.resize(frame.frameSize());
+			frame.serialize(copied.data());
+			first = copied.data();
+			last = first + copied.size();
+			t = m9n.post(frame, notify ? done : nullptr);
+		}
+		else if(kind == 4){	// Encoded at compile time.
+			first = encoded.data();
+			last = first + encoded.size();
+			t = m9n.post(UBX::Encoded(encoded), notify ? done : nullptr);
+		}
+		else if( (kind < 9) || (i % 29 != 0) ){	// A segment of flash.
+			first = flash + rand() % 100000;
+			last = first + 1 + rand() % 2000;
+			t = m9n.post(first, last, notify ? done : nullptr, nullptr, Lane::COMMAND);
+			inPlace += (t != UART::Tx::wouldBlock);
+		}
+		else{	// Larger than one DMA transfer.
+			first = flash;
+			last = flash + 140000;
+			t = m9n.post(first, last, notify ? done : nullptr, nullptr, Lane::COMMAND);
+			large += (t != UART::Tx::wouldBlock);
+		}
+		if(HAL_GetTick() != t0) waited++;
+		if(t == UART::Tx::wouldBlock){
+			wouldBlock++;
+			HAL_Sim::advance(1);
+			continue;
+		}
+
+		posted.insert(posted.end(), first, last);
+		if(t != posted.size()) misnumbered++;
+		if(notify) expected.push_back(t);
+		if(rand() % 3 == 0) HAL_Sim::advance(rand() % 5);
+	}
+	HAL_Sim::advance(20000);
+
+	printf("%zu characters posted, %d in place, %d larger than a transfer, %d would have blocked\n", posted.size(), inPlace, large, wouldBlock);
+	check( (waited == 0) && (misnumbered == 0), "No post waits, and each token counts the characters posted");
+	check(large > 0, "Uploads larger than one DMA transfer accepted");
+	check(received == posted, "Every segment received once and in order");
+	check( (notified == expected) && (early == 0), "Every notification delivered once, in order and after its segment");
+
+	// Data held in place takes no space in the Tx buffer, though larger than it.
+	const UBX::CFG::VAL::SET::TRANSACTION full{UBX::CFG::VAL::Action::TRANSACTIONLESS, kv.data(), kv.data() + kv.size()};
+	const Token upload = m9n.post(flash, flash + 4000, nullptr, nullptr, Lane::COMMAND);
+	check( (upload != UART::Tx::wouldBlock) && (m9n.post(full) != UART::Tx::wouldBlock),
+		"A frame is copied in while an upload held in place is queued");
+	HAL_Sim::advance(1000);
+
+	// Segments which continue on in memory, queued while the UART is busy, are chained into one transfer.
+	received.clear();
+	transfers = 0;
+	m9n.post(flash, flash + 100, nullptr, nullptr, Lane::COMMAND);
+	for(int k = 1; k <= 10; k++) m9n.post(flash + 100 * k, flash + 100 * (k + 1), nullptr, nullptr, Lane::COMMAND);
+	HAL_Sim::advance(100);
+	printf("Chained: %d transfers for %zu characters\n", transfers, received.size());
+	check( (received.size() == 1100u) && std::equal(received.begin(), received.end(), flash) && (transfers == 2),
+		"Contiguous segments joined into one transfer");
+
+	return result();
+}
+
+/*** END OF FILE ***/
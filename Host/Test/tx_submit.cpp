@@ -0,0 +1,101 @@
+/**
+  ******************************************************************************
+  * @file			: tx_submit.cpp
+  * @brief			: Test of Non-blocking Tx Submission and Completion Notification
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Posts thousands of CFG-VALSET frames of random size through M9N::post(), many faster than the line can carry them,
+ * advancing the simulated clock only between posts. No post may wait: each either returns wouldBlock or a token
+ * counting the characters posted so far. Every frame posted must reach the receiver once and in order, and each
+ * notification must arrive once, in order, and only after its frame has left the UART.
+ */
+
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+using KeyValuePair = UBX::CFG::VAL::KeyValuePair;
+using Token = UART::Tx::Token;
+
+static std::vector<uint8_t> received;	// Everything the receiver has been sent.
+static std::vector<Token> notified;
+static int early = 0;					// Notifications before their frame reached the receiver.
+
+static void receiver(UART_HandleTypeDef *, const uint8_t * d, uint16_t n, void *){
+	received.insert(received.end(), d, d + n);
+}
+
+static void done(Token t, void *){
+	notified.push_back(t);
+	if(received.size() < t) early++;
+}
+
+int main(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 115200u;
+	HAL_UART_Init(&huart4);
+	HAL_Sim::setTxSink(&huart4, receiver, nullptr);
+
+	std::vector<KeyValuePair> kv(UBX::CFG::VAL::SET::maxKeys);
+	for(size_t i = 0u; i < kv.size(); i++) kv[i] = {CFG_MSGOUT_NMEA_ID_GGA_UART1, static_cast<UBX::U1>(i)};
+
+	std::vector<uint8_t> posted;
+	std::vector<Token> expected;
+	int wouldBlock = 0, waited = 0, misnumbered = 0;
+	srand(2);
+	for(int i = 0; i < 20000; i++){
+		const size_t n = 1u + rand() % kv.size();
+		const UBX::CFG::VAL::SET::TRANSACTION frame{UBX::CFG::VAL::Action::TRANSACTIONLESS, kv.data(), kv.data() + n};
+		const bool notify = rand() % 2;
+
+		const uint32_t t0 = HAL_GetTick();
+		const Token t = m9n.post(frame, notify ? done : nullptr);
+		if(HAL_GetTick() != t0) waited++;
+		if(t == UART::Tx::wouldBlock){
+			wouldBlock++;
+			HAL_Sim::advance(1);
+			continue;
+		}
+
+		const size_t at = posted.size();
+		posted.resize(at + frame.frameSize());
+		frame.serialize(posted.data() + at);
+		if(t != posted.size()) misnumbered++;
+		if(notify) expected.push_back(t);
+		if(rand() % 3 == 0) HAL_Sim::advance(rand() % 5);
+	}
+	HAL_Sim::advance(5000);
+
+	printf("%zu characters posted, %d posts would have blocked\n", posted.size(), wouldBlock);
+	check(waited == 0, "No post waits");
+	check(wouldBlock > 0, "A full Tx buffer returns wouldBlock");
+	check(misnumbered == 0, "Each token counts the characters posted");
+	check(received == posted, "Every frame received once and in order");
+	check(notified == expected, "Every notification delivered once and in order");
+	check(early == 0, "No notification before its frame is sent");
+	check(m9n.sent(static_cast<Token>(posted.size())) && !m9n.sent(static_cast<Token>(posted.size() + 1u)), "sent() reports the last frame only once sent");
+
+	return result();
+}
+
+/*** END OF FILE ***/
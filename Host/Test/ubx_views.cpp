@@ -0,0 +1,324 @@
+/**
+  ******************************************************************************
+  * @file			: ubx_views.cpp
+  * @brief			: Test of the UBX Payload Schema and Message Views
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Encodes frames with the Field setters, as the receiver would send them, and reads each field back through the
+ * message's view. Frames of another message, or too short for the message, must leave the view invalid. Integer
+ * fields must be read and written at compile time. Repeated blocks must be bounded by the frame received, and text
+ * fields by their width.
+ */
+
+#include "Check.hpp"
+#include "M9N_C_API.hpp"
+#include "UBX_ACK.hpp"
+#include "UBX_INF.hpp"
+#include "UBX_LOG.hpp"
+#include "UBX_MGA.hpp"
+#include "UBX_MON.hpp"
+#include "UBX_NAV.hpp"
+#include "UBX_RXM.hpp"
+#include "UBX_TIM.hpp"
+
+#include <cstring>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+/* Compile-Time Access */
+
+constexpr uint8_t le[] = { 0x00u, 0x78u, 0x56u, 0x34u, 0x12u, 0xFEu, 0xFFu };
+static_assert(UBX::Field<UBX::U4, 1>::get(le) == 0x12345678u, "U4 is read little-endian, unaligned");
+static_assert(UBX::Field<UBX::I2, 5>::get(le) == -2, "I2 is sign-extended");
+static_assert(UBX::Field<UBX::I4, 28>::end == 32u, "end is one past the field");
+
+constexpr uint8_t written(){
+	uint8_t p[4] = {};
+	UBX::Field<UBX::I2, 1>::set(p, -3);
+	return p[1] ^ p[2];
+}
+static_assert(written() == (0xFDu ^ 0xFFu), "I2 is written little-endian");
+static_assert(UBX::Array<UBX::U2, 1, 3>::get(le, 1) == 0x1234u, "Array elements follow one another");
+static_assert(UBX::MGA::GPS::length(UBX::MGA::GPS::Type::EPH) == 68u, "MGA lengths are known at compile time");
+
+/**
+ * @brief A complete frame of the payload given.
+ */
+static std::vector<uint8_t> frame(UBX::U1 msgClass, UBX::U1 msgID, const std::vector<uint8_t> & payload){
+	std::vector<uint8_t> f{0xB5u, 0x62u, msgClass, msgID, 0u, 0u};
+	UBX::Field<UBX::U2, 4>::set(f.data(), static_cast<UBX::U2>(payload.size()));
+	f.insert(f.end(), payload.begin(), payload.end());
+
+	uint8_t ckA = 0u, ckB = 0u;
+	for(size_t i = 2u; i < f.size(); i++){
+		ckA += f[i];
+		ckB += ckA;
+	}
+	f.push_back(ckA);
+	f.push_back(ckB);
+	return f;
+}
+
+static void dop(){
+	typedef UBX::NAV::DOP DOP;
+	std::vector<uint8_t> p(DOP::payloadLen);
+	DOP::iTOW.set(p.data(), 465798000u);
+	DOP::gDOP.set(p.data(), 221u);
+	DOP::pDOP.set(p.data(), 194u);
+	DOP::tDOP.set(p.data(), 105u);
+	DOP::vDOP.set(p.data(), 154u);
+	DOP::hDOP.set(p.data(), 118u);
+	DOP::nDOP.set(p.data(), 71u);
+	DOP::eDOP.set(p.data(), 94u);
+
+	const auto f = frame(UBX::NAV::classID, DOP::ID, p);
+	const DOP d{f.data(), f.data() + f.size()};
+	check(d.valid() && (d.get(d.iTOW) == 465798000u) && (d.get(d.gDOP) == 221u) && (d.get(d.pDOP) == 194u)
+		&& (d.get(d.tDOP) == 105u) && (d.get(d.vDOP) == 154u) && (d.get(d.hDOP) == 118u) && (d.get(d.nDOP) == 71u)
+		&& (d.get(d.eDOP) == 94u), "NAV-DOP fields");
+	check(!DOP{f.data(), f.data() + f.size() - 1u}.valid() && !UBX::NAV::TIME::UTC{f.data(), f.data() + f.size()}.valid(),
+		"NAV-DOP rejects a truncated frame, and is not NAV-TIMEUTC");
+}
+
+static void timeutc(){
+	typedef UBX::NAV::TIME::UTC UTC;
+	std::vector<uint8_t> p(UTC::payloadLen);
+	UTC::iTOW.set(p.data(), 465798000u);
+	UTC::tAcc.set(p.data(), 25u);
+	UTC::nano.set(p.data(), -5021);
+	UTC::year.set(p.data(), 2022u);
+	UTC::month.set(p.data(), 12u);
+	UTC::day.set(p.data(), 9u);
+	UTC::hour.set(p.data(), 9u);
+	UTC::min.set(p.data(), 23u);
+	UTC::sec.set(p.data(), 60u);	// Leap second.
+	UTC::validFlags.set(p.data(), 0x37u);
+
+	const auto f = frame(UBX::NAV::classID, UTC::ID, p);
+	const UTC t{f.data(), f.data() + f.size()};
+	check(t.valid() && (t.get(t.tAcc) == 25u) && (t.get(t.nano) == -5021) && (t.get(t.year) == 2022u)
+		&& (t.get(t.month) == 12u) && (t.get(t.day) == 9u) && (t.get(t.hour) == 9u) && (t.get(t.min) == 23u)
+		&& (t.get(t.sec) == 60u) && t.validUTC(), "NAV-TIMEUTC fields");
+}
+
+static void ack(){
+	const auto a = frame(UBX::ACKNAK::classID, UBX::ACKNAK::ACK::ID, {0x06u, 0x8Au});
+	const auto n = frame(UBX::ACKNAK::classID, UBX::ACKNAK::NAK::ID, {0x06u, 0x8Bu});
+	const UBX::ACKNAK::ACK acked{a.data(), a.data() + a.size()};
+	const UBX::ACKNAK::NAK naked{n.data(), n.data() + n.size()};
+	check(acked.valid() && (acked.get(acked.ackClsID) == 0x06u) && (acked.get(acked.ackMsgID) == 0x8Au), "ACK-ACK fields");
+	check(naked.valid() && (naked.get(naked.ackClsID) == 0x06u) && (naked.get(naked.ackMsgID) == 0x8Bu), "ACK-NAK fields");
+	check(!UBX::ACKNAK::NAK{a.data(), a.data() + a.size()}.valid() && !UBX::ACKNAK::ACK{n.data(), n.data() + n.size()}.valid(),
+		"ACK-ACK and ACK-NAK are told apart");
+}
+
+static bool same(const StaticString & s, const char * c){
+	return (s.size() == strlen(c)) && (memcmp(s.begin(), c, s.size()) == 0);
+}
+
+static void sat(){
+	typedef UBX::NAV::SAT SAT;
+	std::vector<uint8_t> p(SAT::payloadLen + 3u * SAT::svLen);
+	SAT::iTOW.set(p.data(), 465798000u);
+	SAT::numSvs.set(p.data(), 3u);
+	for(uint8_t i = 0; i < 3u; i++){
+		uint8_t * sv = p.data() + SAT::payloadLen + SAT::svLen * i;
+		SAT::Sv::gnssId.set(sv, i);
+		SAT::Sv::svId.set(sv, 10u + i);
+		SAT::Sv::cno.set(sv, 40u + i);
+		SAT::Sv::elev.set(sv, -5);
+		SAT::Sv::azim.set(sv, 270);
+		SAT::Sv::flags.set(sv, (i == 1u) ? 0x1Fu : 0x04u);	// Satellite 1: carrier locked, used, healthy.
+	}
+
+	const auto f = frame(UBX::NAV::classID, SAT::ID, p);
+	const SAT s{f.data(), f.data() + f.size()};
+	check(s.valid() && (s.count() == 3u) && (s.sv(2, SAT::Sv::svId) == 12u) && (s.sv(1, SAT::Sv::cno) == 41u)
+		&& (s.sv(0, SAT::Sv::elev) == -5) && (s.sv(2, SAT::Sv::azim) == 270), "NAV-SAT satellite blocks");
+	check(s.svUsed(1) && (s.qualityInd(1) == 7u) && (s.health(1) == 1u) && !s.svUsed(0) && (s.qualityInd(0) == 4u),
+		"NAV-SAT flags");
+
+	auto q = p;
+	SAT::numSvs.set(q.data(), 9u);	// More than the frame holds.
+	const auto g = frame(UBX::NAV::classID, SAT::ID, q);
+	check(SAT{g.data(), g.data() + g.size()}.count() == 3u, "NAV-SAT count is bounded by the frame");
+}
+
+static void status(){
+	typedef UBX::NAV::STATUS STATUS;
+	std::vector<uint8_t> p(STATUS::payloadLen);
+	STATUS::gpsFix.set(p.data(), 3u);
+	STATUS::flags.set(p.data(), 0x0Du);
+	STATUS::ttff.set(p.data(), 28500u);
+	STATUS::msss.set(p.data(), 1234567u);
+
+	const auto f = frame(UBX::NAV::classID, STATUS::ID, p);
+	const STATUS s{f.data(), f.data() + f.size()};
+	check(s.valid() && (s.get(s.gpsFix) == 3u) && s.gpsFixOk() && !s.diffSoln() && s.wknSet() && s.towSet()
+		&& (s.get(s.ttff) == 28500u) && (s.get(s.msss) == 1234567u), "NAV-STATUS fields");
+}
+
+static void velned(){
+	typedef UBX::NAV::VEL::NED NED;
+	std::vector<uint8_t> p(NED::payloadLen);
+	NED::velN.set(p.data(), -150);
+	NED::velE.set(p.data(), 220);
+	NED::velD.set(p.data(), -3);
+	NED::gSpeed.set(p.data(), 266u);
+	NED::heading.set(p.data(), 12345678);
+	NED::cAcc.set(p.data(), 500000u);
+
+	const auto f = frame(UBX::NAV::classID, NED::ID, p);
+	const NED v{f.data(), f.data() + f.size()};
+	check(v.valid() && (v.get(v.velN) == -150) && (v.get(v.velE) == 220) && (v.get(v.velD) == -3)
+		&& (v.get(v.gSpeed) == 266u) && (v.get(v.heading) == 12345678) && (v.get(v.cAcc) == 500000u), "NAV-VELNED fields");
+	check(!UBX::NAV::VEL::ECEF{f.data(), f.data() + f.size()}.valid(), "NAV-VELNED is not NAV-VELECEF");
+}
+
+static void ver(){
+	typedef UBX::MON::VER VER;
+	std::vector<uint8_t> p(VER::payloadLen + 2u * VER::extensionLen);
+	memcpy(p.data(), "ROM SPG 5.10 (7b202e)", 21);
+	memcpy(p.data() + VER::swVersionLen, "000A0000", 8);
+	memcpy(p.data() + VER::payloadLen, "PROTVER=32.01", 13);
+	memset(p.data() + VER::payloadLen + VER::extensionLen, 'X', VER::extensionLen);	// Fills the field, without a NUL.
+
+	const auto f = frame(UBX::MON::classID, VER::ID, p);
+	const VER v{f.data(), f.data() + f.size()};
+	check(v.valid() && same(v.swVersion(), "ROM SPG 5.10 (7b202e)") && same(v.hwVersion(), "000A0000")
+		&& (v.extensions() == 2u) && same(v.extension(0), "PROTVER=32.01"), "MON-VER strings");
+	check(v.extension(1).size() == VER::extensionLen, "MON-VER reads no further than a field without a NUL");
+}
+
+static void comms(){
+	typedef UBX::MON::COMMS COMMS;
+	std::vector<uint8_t> p(COMMS::payloadLen + 2u * COMMS::portLen);
+	COMMS::nPorts.set(p.data(), 2u);
+	COMMS::protIds.set(p.data(), 1, 1u);	// NMEA
+	uint8_t * port = p.data() + COMMS::payloadLen + COMMS::portLen;
+	COMMS::Port::portId.set(port, 0x0101u);
+	COMMS::Port::rxBytes.set(port, 987654u);
+	COMMS::Port::msgs.set(port, 1, 4321u);
+
+	const auto f = frame(UBX::MON::classID, COMMS::ID, p);
+	const COMMS c{f.data(), f.data() + f.size()};
+	check(c.valid() && (c.count() == 2u) && (c.get(c.protIds, 1) == 1u) && (c.port(1, COMMS::Port::portId) == 0x0101u)
+		&& (c.port(1, COMMS::Port::rxBytes) == 987654u) && (c.port(1, COMMS::Port::msgs, 1) == 4321u)
+		&& (c.port(0, COMMS::Port::msgs, 1) == 0u), "MON-COMMS port blocks and arrays");
+}
+
+static void inf(){
+	const char text[] = "Antenna open";
+	const auto f = frame(UBX::INF::classID, UBX::INF::WARNING::ID, std::vector<uint8_t>(text, text + strlen(text)));
+	const UBX::INF::WARNING w{f.data(), f.data() + f.size()};
+	check(w.valid() && same(w.str(), text) && !UBX::INF::ERROR{f.data(), f.data() + f.size()}.valid(), "INF-WARNING string");
+}
+
+static void sec(){
+	const auto f = frame(UBX::SEC::classID, UBX::SEC::UNIQID::ID, {0x01u, 0u, 0u, 0u, 0xE0u, 0x95u, 0x65u, 0x0Fu, 0x2Au});
+	const UBX::SEC::UNIQID u{f.data(), f.data() + f.size()};
+	check(u.valid() && (u.get(u.version) == 1u) && (u.get(u.uniqueId, 0) == 0xE0u) && (u.get(u.uniqueId, 4) == 0x2Au),
+		"SEC-UNIQID chip ID");
+
+	typedef UBX::UPD::SOS SOS;
+	const auto cmd = frame(UBX::UPD::classID, SOS::ID, {0u, 0u, 0u, 0u});
+	const auto res = frame(UBX::UPD::classID, SOS::ID, {3u, 0u, 0u, 0u, 2u, 0u, 0u, 0u});
+	const SOS c{cmd.data(), cmd.data() + cmd.size()};
+	const SOS r{res.data(), res.data() + res.size()};
+	check(c.valid() && !c.hasResponse() && r.hasResponse() && (r.get(r.cmd) == static_cast<UBX::U1>(SOS::Cmd::RESTORED))
+		&& (r.get(r.response) == 2u), "UPD-SOS command and response");
+}
+
+static void mga(){
+	typedef UBX::MGA::ACK ACK;
+	const auto a = frame(UBX::MGA::classID, ACK::ID, {1u, 0u, 0u, UBX::MGA::INI::ID, 0x01u, 0x00u, 0x00u, 0x00u});
+	const ACK acked{a.data(), a.data() + a.size()};
+	check(acked.valid() && acked.accepted() && (acked.get(acked.infoCode) == static_cast<UBX::U1>(ACK::InfoCode::ACCEPTED))
+		&& (acked.get(acked.msgId) == UBX::MGA::INI::ID) && (acked.get(acked.msgPayloadStart, 0) == 0x01u), "MGA-ACK fields");
+
+	typedef UBX::MGA::INI INI;
+	std::vector<uint8_t> p(INI::POS_LLH::payloadLen);
+	INI::type.set(p.data(), INI::POS_LLH::type);
+	INI::POS_LLH::lat.set(p.data(), -339249000);
+	INI::POS_LLH::lon.set(p.data(), 184241000);
+	INI::POS_LLH::posAcc.set(p.data(), 100000u);
+	const auto f = frame(UBX::MGA::classID, INI::ID, p);
+	const INI i{f.data(), f.data() + f.size()};
+	check(i.valid() && (i.get(i.type) == INI::POS_LLH::type) && (i.get(INI::POS_LLH::lat) == -339249000)
+		&& (i.get(INI::POS_LLH::lon) == 184241000) && (i.get(INI::POS_LLH::posAcc) == 100000u), "MGA-INI-POS_LLH fields");
+}
+
+static void rxm(){
+	typedef UBX::RXM::SFRBX SFRBX;
+	std::vector<uint8_t> p(SFRBX::payloadLen + 10u * SFRBX::wordLen);
+	SFRBX::svId.set(p.data(), 7u);
+	SFRBX::numWords.set(p.data(), 10u);
+	UBX::Field<UBX::U4, SFRBX::payloadLen + 9u * SFRBX::wordLen>::set(p.data(), 0x22C0DEADu);
+
+	const auto f = frame(UBX::RXM::classID, SFRBX::ID, p);
+	const SFRBX s{f.data(), f.data() + f.size()};
+	check(s.valid() && (s.get(s.svId) == 7u) && (s.count() == 10u) && (s.dwrd(9) == 0x22C0DEADu), "RXM-SFRBX words");
+}
+
+static void tim(){
+	typedef UBX::TIM::TP TP;
+	std::vector<uint8_t> p(TP::payloadLen);
+	TP::towMS.set(p.data(), 465799000u);
+	TP::qErr.set(p.data(), -1234);
+	TP::week.set(p.data(), 2240u);
+
+	const auto f = frame(UBX::TIM::classID, TP::ID, p);
+	const TP t{f.data(), f.data() + f.size()};
+	check(t.valid() && (t.get(t.towMS) == 465799000u) && (t.get(t.qErr) == -1234) && (t.get(t.week) == 2240u),
+		"TIM-TP fields");
+}
+
+static void logString(){
+	typedef UBX::LOG::RETRIEVE_STRING RS;
+	const char text[] = "Waypoint";
+	std::vector<uint8_t> p(RS::payloadLen);
+	RS::entryIndex.set(p.data(), 42u);
+	RS::year.set(p.data(), 2022u);
+	RS::byteCount.set(p.data(), 20u);	// More than the frame holds.
+	p.insert(p.end(), text, text + strlen(text));
+
+	const auto f = frame(UBX::LOG::classID, RS::ID, p);
+	const RS r{f.data(), f.data() + f.size()};
+	check(r.valid() && (r.get(r.entryIndex) == 42u) && (r.get(r.year) == 2022u) && same(r.bytes(), text),
+		"LOG-RETRIEVESTRING string, bounded by the frame");
+}
+
+int main(){
+	dop();
+	timeutc();
+	ack();
+	sat();
+	status();
+	velned();
+	ver();
+	comms();
+	inf();
+	sec();
+	mga();
+	rxm();
+	tim();
+	logString();
+	return result();
+}
+
+/*** END OF FILE ***/
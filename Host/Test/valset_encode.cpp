@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file			: valset_encode.cpp
+  * @brief			: Test of the In-Place UBX-CFG-VALSET Encoder
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Encodes CFG-VALSET frames in place and compares them byte-for-byte with frames assembled by hand. Every value type
+ * must be written little-endian at its size, signed values in two's complement and R4 values bit-for-bit. The frame
+ * must fill exactly frameSize() characters, the member, static and compile-time (SET::encode<>()) encoders must agree,
+ * and push() must refuse a key beyond maxKeys. UBX::Writer is also checked on its own.
+ */
+
+#include "Check.hpp"
+#include "M9N_C_API.hpp"
+
+#include <cstring>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+template<typename T> using Key = UBX::CFG::VAL::Key<T>;
+using KeyValuePair = UBX::CFG::VAL::KeyValuePair;
+using SET = UBX::CFG::VAL::SET;
+using Layers = UBX::CFG::VAL::SET::Layers;
+
+/**
+ * @brief Appends the Fletcher checksum of f, from its class onwards.
+ */
+static std::vector<uint8_t> & checksum(std::vector<uint8_t> & f){
+	uint8_t ckA = 0u, ckB = 0u;
+	for(size_t i = 2u; i < f.size(); i++){
+		ckA += f[i];
+		ckB += ckA;
+	}
+	f.push_back(ckA);
+	f.push_back(ckB);
+	return f;
+}
+
+/* A constant profile of every integral width, encoded at compile time. */
+static constexpr KeyValuePair profile[] = {
+	{Key<UBX::L>(0x10110013u), true},
+	{Key<UBX::U1>(0x20110021u), static_cast<UBX::U1>(4u)},
+	{Key<UBX::I1>(0x20110011u), static_cast<UBX::I1>(-3)},
+	{Key<UBX::I2>(0x30210001u), static_cast<UBX::I2>(-1000)},
+	{Key<UBX::U4>(0x40520001u), static_cast<UBX::U4>(115200u)},
+};
+static constexpr auto encoded = SET::encode<profile, Layers::BBR>();
+
+static constexpr bool checksummed(const uint8_t * f, size_t n){
+	uint8_t ckA = 0u, ckB = 0u;
+	for(size_t i = 2u; i < n - 2u; i++){
+		ckA += f[i];
+		ckB += ckA;
+	}
+	return (f[n - 2u] == ckA) && (f[n - 1u] == ckB);
+}
+
+static_assert(encoded.size() == SET::frameSize(std::begin(profile), std::end(profile)), "Encoded frame is frameSize()");
+static_assert( (encoded[2] == UBX::CFG::classID) && (encoded[3] == SET::ID) && (encoded[4] == encoded.size() - 8u)
+	&& (encoded[7] == static_cast<uint8_t>(Layers::BBR)), "Encoded header");
+static_assert( (encoded[10] == 0x13u) && (encoded[13] == 0x10u) && (encoded[14] == 1u), "First pair encoded in place");
+static_assert(checksummed(encoded.data(), encoded.size()), "Encoded checksum");
+
+static void writer(){
+	uint8_t p[8 + 6] = {};
+	UBX::Writer w(p, 0x0Au, 0x04u, 6u);
+	w.put(static_cast<UBX::U2>(0x1234u));
+	w.put(static_cast<UBX::I4>(-2));
+	const auto n = w.finish();
+
+	std::vector<uint8_t> f{0xB5u, 0x62u, 0x0Au, 0x04u, 6u, 0u, 0x34u, 0x12u, 0xFEu, 0xFFu, 0xFFu, 0xFFu};
+	checksum(f);
+	check( (n == sizeof(p)) && (memcmp(p, f.data(), sizeof(p)) == 0), "Writer frames little-endian values with the checksum");
+}
+
+int main(){
+	writer();
+
+	const float r4 = -1.5f;
+	uint32_t r4Bits;
+	memcpy(&r4Bits, &r4, sizeof(r4Bits));
+
+	const KeyValuePair kv[] = {
+		profile[0], profile[1], profile[2], profile[3], profile[4],
+		KeyValuePair(Key<UBX::R4>(0x40110064u), r4),
+	};
+
+	std::vector<uint8_t> f{0xB5u, 0x62u, 0x06u, 0x8Au, 0u, 0u, 0x00u, 0x02u, 0x00u, 0x00u};
+	const auto key = [&f](uint32_t k){ for(int i = 0; i < 4; i++) f.push_back(static_cast<uint8_t>(k >> (8 * i))); };
+	key(0x10110013u); f.push_back(1u);
+	key(0x20110021u); f.push_back(4u);
+	key(0x20110011u); f.push_back(0xFDu);
+	key(0x30210001u); f.push_back(0x18u); f.push_back(0xFCu);
+	key(0x40520001u); f.push_back(0x00u); f.push_back(0xC2u); f.push_back(0x01u); f.push_back(0x00u);
+	key(0x40110064u); for(int i = 0; i < 4; i++) f.push_back(static_cast<uint8_t>(r4Bits >> (8 * i)));
+	UBX::Field<UBX::U2, 4>::set(f.data(), static_cast<UBX::U2>(f.size() - 6u));
+	checksum(f);
+
+	SET set(kv[0], Layers::BBR);
+	bool pushed = true;
+	for(size_t i = 1; i < sizeof(kv) / sizeof(kv[0]); i++) pushed &= set.push(kv[i]);
+
+	std::vector<uint8_t> p(set.frameSize() + 1u, 0xA5u);	// One guard character.
+	const auto n = set.serialize(p.data());
+	check(pushed && (set.frameSize() == f.size()) && (n == f.size()), "The frame is exactly frameSize()");
+	check(memcmp(p.data(), f.data(), f.size()) == 0, "Every value type is encoded as assembled by hand");
+	check(p.back() == 0xA5u, "Nothing is written past the frame");
+
+	std::vector<uint8_t> q(SET::frameSize(kv, kv + 6));
+	check( (SET::serialize(q.data(), Layers::BBR, kv, kv + 6) == q.size()) && (q == f),
+		"Key-value pairs held elsewhere encode alike");
+
+	SET constant(profile[0], Layers::BBR);
+	for(size_t i = 1; i < sizeof(profile) / sizeof(profile[0]); i++) constant.push(profile[i]);
+	std::vector<uint8_t> c(constant.frameSize());
+	check( (constant.serialize(c.data()) == encoded.size()) && (memcmp(c.data(), encoded.data(), encoded.size()) == 0),
+		"SET::encode<>() matches serialize()");
+
+	SET full(kv[1]);
+	bool fits = true;
+	for(uint8_t i = 1u; i < SET::maxKeys; i++) fits &= full.push(kv[1]);
+	std::vector<uint8_t> g(full.frameSize());
+	check(fits && !full.push(kv[1]) && (full.frameSize() == 8u + 4u + SET::maxKeys * 5u)
+		&& (full.serialize(g.data()) == g.size()), "push() refuses a key beyond maxKeys");
+
+	return result();
+}
+
+/*** END OF FILE ***/
@@ -0,0 +1,171 @@
+/**
+  ******************************************************************************
+  * @file			: valset_transaction.cpp
+  * @brief			: Test of Configuration Profiles Sent as CFG-VALSET Transactions
+  * @author			: Lawrence Stanton
+  ******************************************************************************
+  * @attention
+  *
+  * © LD Stanton 2022
+  *
+  * This file and its content are the copyright property of the author. All
+  * rights are reserved. No warranty is given. No liability is assumed.
+  * Confidential unless licensed otherwise. If licensed, refer to the
+  * accompanying file "LICENCE" for license details.
+  *
+  ******************************************************************************
+  */
+
+/**
+ * Sends profiles through M9N::configure() to a simulated receiver which decodes every UBX-CFG-VALSET frame it is sent
+ * and acknowledges it, or rejects a chosen frame. A profile which fits one frame must be sent without a transaction.
+ * A larger profile must be split into RE_START, ONGOING and APPLY frames of at most 64 keys and UART::Tx::capacity
+ * characters, each sent only once the last is acknowledged, carrying every key-value pair once and in order.
+ */
+
+#include "Check.hpp"
+#include "HAL_Sim.hpp"
+#include "M9N_C_API.hpp"
+
+#include <cstdio>
+#include <vector>
+
+UART_HandleTypeDef huart4;
+GPS_Data_t gpsDataLive = {};
+
+template<typename T> using Key = UBX::CFG::VAL::Key<T>;
+using KeyValuePair = UBX::CFG::VAL::KeyValuePair;
+using Action = UBX::CFG::VAL::Action;
+
+/* Simulated Receiver */
+
+struct Valset{
+	uint8_t version;
+	uint8_t layers;
+	uint8_t action;
+	uint16_t size;	// Of the frame.
+	std::vector<std::pair<uint32_t, uint32_t>> kv;
+};
+
+static std::vector<Valset> received;
+static size_t nakFrame = SIZE_MAX;	// Index of the frame to reject.
+static uint8_t maxInFlight = 0u;	// Commands awaiting acknowledgement as each frame arrives.
+
+static void respond(bool ack){
+	uint8_t f[10] = {0xB5u, 0x62u, 0x05u, static_cast<uint8_t>(ack ? 0x01u : 0x00u), 2u, 0u, 0x06u, 0x8Au, 0u, 0u};
+	for(int k = 2; k < 8; k++){
+		f[8] += f[k];
+		f[9] += f[8];
+	}
+	HAL_Sim::feed(&huart4, f, sizeof(f));
+}
+
+static void receiver(UART_HandleTypeDef *, const uint8_t * d, uint16_t n, void *){
+	for(uint16_t k = 0u; k + 8u <= n; k++){
+		if( (d[k] != 0xB5u) || (d[k+1] != 0x62u) || (d[k+2] != 0x06u) || (d[k+3] != 0x8Au) ) continue;
+		const uint16_t len = d[k+4] | (d[k+5] << 8);
+		if(k + 8u + len > n) return;
+
+		const uint8_t * p = d + k + 6u;
+		Valset v{p[0], p[1], p[2], static_cast<uint16_t>(len + 8u), {}};
+		for(uint16_t i = 4u; i + 4u <= len; ){
+			const uint32_t key = UBX::Field<uint32_t, 0>::get(p + i);
+			const uint8_t size = UBX::CFG::VAL::KeyID(key).valueSize();
+			uint32_t value = 0u;
+			for(uint8_t b = 0u; b < size; b++) value |= static_cast<uint32_t>(p[i + 4u + b]) << (8u * b);
+			v.kv.push_back({key, value});
+			i += 4u + size;
+		}
+		if(m9n.pending().inFlight() > maxInFlight) maxInFlight = m9n.pending().inFlight();
+		respond(received.size() != nakFrame);
+		received.push_back(v);
+		k += 7u + len;
+	}
+}
+
+/**
+ * @brief A profile of n pairs of the GGA rate key, with values counting up so that their order can be checked.
+ */
+static std::vector<KeyValuePair> profile(size_t n){
+	std::vector<KeyValuePair> kv(n);
+	for(size_t i = 0; i < n; i++) kv[i] = {CFG_MSGOUT_NMEA_ID_GGA_UART1, static_cast<UBX::U1>(i)};
+	return kv;
+}
+
+static bool inOrder(const std::vector<Valset> & frames, size_t n){
+	size_t i = 0u;
+	for(const auto & f : frames)
+		for(const auto & kv : f.kv) if( (kv.first != CFG_MSGOUT_NMEA_ID_GGA_UART1.toKey()) || (kv.second != (i++ & 0xFFu)) ) return false;
+	return i == n;
+}
+
+int main(){
+	huart4.Instance = UART4;
+	huart4.Init.BaudRate = 38400u;
+	HAL_UART_Init(&huart4);
+	HAL_Sim::setTxSink(&huart4, receiver, nullptr);
+	GPS_Init();	// Sends the boot profile.
+
+	// One frame: no transaction.
+	auto kv = profile(2u);
+	received.clear();
+	check(m9n.configure(kv.data(), kv.data() + kv.size()) == AckTracker::Result::ACK, "Small profile acknowledged");
+	check( (received.size() == 1u) && (received[0].version == 0u) && (received[0].action == 0u) && (received[0].layers == 0x01u)
+		&& inOrder(received, kv.size()), "Small profile sent as one frame without a transaction");
+
+	// Many frames: one transaction.
+	kv = profile(150u);
+	received.clear();
+	maxInFlight = 0u;
+	const uint32_t t0 = HAL_GetTick();
+	check(m9n.configure(kv.data(), kv.data() + kv.size(), UBX::CFG::VAL::SET::Layers::BBR) == AckTracker::Result::ACK,
+		"150 keys acknowledged");
+	printf("150 keys: %zu frames in %u ms\n", received.size(), static_cast<unsigned>(HAL_GetTick() - t0));
+
+	bool actions = received.size() >= 3u, limits = true, versions = true;
+	for(size_t i = 0u; i < received.size(); i++){
+		const Action expected = (i == 0u) ? Action::RE_START : (i + 1u == received.size()) ? Action::APPLY : Action::ONGOING;
+		actions &= (received[i].action == static_cast<uint8_t>(expected));
+		versions &= (received[i].version == 1u) && (received[i].layers == 0x02u);
+		limits &= (received[i].kv.size() <= UBX::CFG::VAL::SET::maxKeys) && (received[i].size <= UART::Tx::capacity);
+	}
+	check(actions, "RE_START, then ONGOING, then APPLY");
+	check(versions, "Transaction frames are version 1 on the given layer");
+	check(limits, "Each frame within 64 keys and the Tx buffer");
+	check(inOrder(received, kv.size()), "Every key sent once and in order");
+	check(maxInFlight <= 1u, "Each frame sent once the last is acknowledged");
+
+	// The Tx buffer bounds a frame: 64 keys filling exactly UART::Tx::capacity fit one frame, one more byte does not.
+	std::vector<KeyValuePair> edge;
+	for(uint16_t i = 0u; i < 59u; i++) edge.push_back({Key<UBX::U4>(0x40520001u), static_cast<UBX::U4>(i)});
+	for(uint16_t i = 0u; i < 2u; i++) edge.push_back({Key<UBX::U2>(0x30210001u), static_cast<UBX::U2>(i)});
+	for(uint16_t i = 0u; i < 3u; i++) edge.push_back({CFG_MSGOUT_NMEA_ID_GGA_UART1, static_cast<UBX::U1>(i)});
+	check(UBX::CFG::VAL::SET::frameSize(edge.data(), edge.data() + edge.size()) == UART::Tx::capacity, "Edge profile fills the Tx buffer");
+	received.clear();
+	check( (m9n.configure(edge.data(), edge.data() + edge.size()) == AckTracker::Result::ACK) && (received.size() == 1u)
+		&& (received[0].action == 0u) && (received[0].size == UART::Tx::capacity), "A frame of capacity is sent whole");
+
+	edge.back() = {Key<UBX::U2>(0x30210001u), static_cast<UBX::U2>(2u)};
+	received.clear();
+	bool fits = true;
+	check( (m9n.configure(edge.data(), edge.data() + edge.size()) == AckTracker::Result::ACK) && (received.size() == 2u)
+		&& (received[0].action == static_cast<uint8_t>(Action::RE_START)), "A frame over capacity is split");
+	for(const auto & f : received) fits &= (f.size <= UART::Tx::capacity);
+	check(fits, "Split frames within capacity");
+
+	// A frame rejected: no further frames.
+	received.clear();
+	nakFrame = 1u;
+	check(m9n.configure(kv.data(), kv.data() + kv.size()) == AckTracker::Result::NAK, "Rejected frame reported");
+	check(received.size() == 2u, "Nothing sent after the rejected frame");
+
+	// The next transaction restarts.
+	received.clear();
+	nakFrame = SIZE_MAX;
+	check( (m9n.configure(kv.data(), kv.data() + kv.size()) == AckTracker::Result::ACK) && !received.empty()
+		&& (received[0].action == static_cast<uint8_t>(Action::RE_START)), "The next transaction restarts");
+
+	return result();
+}
+
+/*** END OF FILE ***/